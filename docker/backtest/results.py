@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+"""Typed store of backtest results with a query CLI.
+
+Ingests tester reports from <Mode>/all-yearly/<year>/_results/*.json
+into a SQLite database. Numbers are parsed, and parameters are exploded
+into one row per input. Runs are indexed by mode, year, deposit and spread.
+
+Usage:
+  ./results.py ingest [--root .]
+  ./results.py rank [--by profit_factor] [--mode Rider] [--year 2020] [--limit 10]
+  ./results.py diff RUN_ID RUN_ID
+"""
+
+import argparse
+import html
+import json
+import os
+import re
+import sqlite3
+import sys
+
+DB_FILE = "results.db"
+
+# Report fields mapped into typed columns of runs (column, type).
+FIELDS = {
+    "Total net profit": ("profit", "REAL"),
+    "Gross profit": ("gross_profit", "REAL"),
+    "Gross loss": ("gross_loss", "REAL"),
+    "Profit factor": ("profit_factor", "REAL"),
+    "Expected payoff": ("expected_payoff", "REAL"),
+    "Absolute drawdown": ("dd_abs", "REAL"),
+    "Maximal drawdown": ("dd_max", "REAL", "dd_max_pct", "REAL"),
+    "Relative drawdown": ("dd_rel_pct", "REAL", "dd_rel", "REAL"),
+    "Total trades": ("trades", "INTEGER"),
+    "Short positions": ("shorts", "INTEGER", "shorts_won_pct", "REAL"),
+    "Long positions": ("longs", "INTEGER", "longs_won_pct", "REAL"),
+    "Profit trades": ("wins", "INTEGER", "wins_pct", "REAL"),
+    "Loss trades": ("losses", "INTEGER", "losses_pct", "REAL"),
+    "consecutive wins (profit in money)": ("cons_wins", "INTEGER", "cons_wins_profit", "REAL"),
+    "consecutive losses (loss in money)": ("cons_losses", "INTEGER", "cons_losses_loss", "REAL"),
+    "Modelling quality": ("quality_pct", "REAL"),
+    "Bars in test": ("bars", "INTEGER"),
+    "Ticks modelled": ("ticks", "INTEGER"),
+}
+
+# Columns which are filters of ranking.
+KEYS = ("mode", "year", "deposit", "spread")
+
+NUMBER = re.compile(r"-?\d+(?:\.\d+)?")
+FILE_NAME = re.compile(
+    r"^EA31337-(?P<mode>[^_]+)_(?P<year>\d{4})_(?P<deposit>\d+)(?P<currency>[A-Z]+)_spread(?P<spread>\d+)"
+)
+
+
+def columns():
+    """Returns typed columns of runs parsed from the report fields."""
+    cols = []
+    for spec in FIELDS.values():
+        cols += list(zip(spec[::2], spec[1::2]))
+    return cols
+
+
+def connect(path):
+    """Opens the database and creates its schema."""
+    db = sqlite3.connect(path)
+    cols = ", ".join("{} {}".format(name, kind) for name, kind in columns())
+    db.executescript(
+        """
+        CREATE TABLE IF NOT EXISTS runs (
+          id INTEGER PRIMARY KEY,
+          path TEXT UNIQUE,
+          mtime REAL,
+          mode TEXT,
+          year INTEGER,
+          deposit REAL,
+          currency TEXT,
+          spread INTEGER,
+          symbol TEXT,
+          build INTEGER,
+          ea_name TEXT,
+          {});
+        CREATE INDEX IF NOT EXISTS runs_keys ON runs (mode, year, deposit, spread);
+        CREATE TABLE IF NOT EXISTS params (
+          run_id INTEGER REFERENCES runs (id) ON DELETE CASCADE,
+          name TEXT,
+          value TEXT,
+          num REAL,
+          PRIMARY KEY (run_id, name));
+        CREATE INDEX IF NOT EXISTS params_name ON params (name, num);
+        """.format(cols)
+    )
+    db.execute("PRAGMA foreign_keys = ON")
+    return db
+
+
+def parse_numbers(value, count):
+    """Parses the leading numbers of the value (e.g. "446.22 (44.62%)")."""
+    nums = [float(n) for n in NUMBER.findall(value or "")[:count]]
+    return nums + [None] * (count - len(nums))
+
+
+def parse_params(value):
+    """Explodes the HTML-escaped parameters into (name, value) pairs."""
+    params = []
+    for item in html.unescape(value or "").split(";"):
+        name, sep, val = item.strip().partition("=")
+        if not sep or name.startswith("__"):
+            # Skips group headers and the trailing separator.
+            continue
+        params.append((name, val.strip('"')))
+    return params
+
+
+def parse_report(path, report):
+    """Converts the report into typed values of runs."""
+    row = {}
+    for field, spec in FIELDS.items():
+        for (name, kind), num in zip(zip(spec[::2], spec[1::2]), parse_numbers(report.get(field), len(spec) // 2)):
+            row[name] = int(num) if kind == "INTEGER" and num is not None else num
+    match = FILE_NAME.match(os.path.basename(path))
+    keys = match.groupdict() if match else {}
+    row["mode"] = keys.get("mode")
+    row["year"] = int(keys["year"]) if "year" in keys else None
+    row["currency"] = keys.get("currency")
+    row["deposit"] = parse_numbers(report.get("Initial deposit", keys.get("deposit")), 1)[0]
+    row["spread"] = parse_numbers(report.get("Spread", keys.get("spread")), 1)[0]
+    row["symbol"] = (report.get("Symbol") or "").split(" ")[0]
+    row["build"] = parse_numbers(report.get("Build"), 1)[0]
+    row["ea_name"] = report.get("EA Name")
+    return row
+
+
+def ingest(db, root):
+    """Ingests new or modified reports found under the root."""
+    count = 0
+    for dirpath, _, files in os.walk(root):
+        if os.path.basename(dirpath) != "_results":
+            continue
+        for file in sorted(files):
+            if not file.endswith(".json"):
+                continue
+            path = os.path.relpath(os.path.join(dirpath, file), root)
+            mtime = os.path.getmtime(os.path.join(root, path))
+            known = db.execute("SELECT mtime FROM runs WHERE path = ?", (path,)).fetchone()
+            if known and known[0] == mtime:
+                continue
+            with open(os.path.join(root, path), encoding="utf-8") as fp:
+                report = json.load(fp)
+            row = parse_report(path, report)
+            row.update(path=path, mtime=mtime)
+            db.execute("DELETE FROM runs WHERE path = ?", (path,))
+            cur = db.execute(
+                "INSERT INTO runs ({}) VALUES ({})".format(", ".join(row), ", ".join("?" * len(row))),
+                list(row.values()),
+            )
+            params = parse_params(report.get("Parameters"))
+            db.executemany(
+                "INSERT OR REPLACE INTO params VALUES (?, ?, ?, ?)",
+                [(cur.lastrowid, name, val, parse_numbers(val, 1)[0]) for name, val in params],
+            )
+            count += 1
+    db.commit()
+    return count
+
+
+def rank(db, args):
+    """Prints runs ordered by the metric."""
+    if args.by not in dict(columns()):
+        sys.exit("Unknown metric: {}".format(args.by))
+    where, values = [], []
+    for key in KEYS:
+        if getattr(args, key) is not None:
+            where.append("{} = ?".format(key))
+            values.append(getattr(args, key))
+    sql = "SELECT id, mode, year, deposit, spread, {0} FROM runs {1} ORDER BY {0} {2} LIMIT ?".format(
+        args.by, "WHERE " + " AND ".join(where) if where else "", "ASC" if args.asc else "DESC"
+    )
+    print("\t".join(("id",) + KEYS + (args.by,)))
+    for row in db.execute(sql, values + [args.limit]):
+        print("\t".join("" if v is None else str(v) for v in row))
+
+
+def diff(db, args):
+    """Prints metrics and parameters which differ between two runs."""
+    runs = []
+    for run_id in (args.run1, args.run2):
+        cur = db.execute("SELECT * FROM runs WHERE id = ?", (run_id,))
+        row = cur.fetchone()
+        if not row:
+            sys.exit("Unknown run: {}".format(run_id))
+        params = dict(db.execute("SELECT name, value FROM params WHERE run_id = ?", (run_id,)))
+        runs.append((dict(zip([d[0] for d in cur.description], row)), params))
+    (run1, params1), (run2, params2) = runs
+    for name in run1:
+        if name not in ("id", "mtime") and run1[name] != run2[name]:
+            print("{}\t{}\t{}".format(name, run1[name], run2[name]))
+    for name in sorted(set(params1) | set(params2)):
+        if params1.get(name) != params2.get(name):
+            print("{}\t{}\t{}".format(name, params1.get(name, ""), params2.get(name, "")))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--db", default=DB_FILE, help="database file (default: %(default)s)")
+    sub = parser.add_subparsers(dest="command", required=True)
+    cmd = sub.add_parser("ingest", help="ingest new or modified reports")
+    cmd.add_argument("--root", default=os.path.dirname(os.path.abspath(__file__)), help="root folder of modes")
+    cmd = sub.add_parser("rank", help="rank runs by the metric")
+    cmd.add_argument("--by", default="profit_factor", help="metric column (default: %(default)s)")
+    cmd.add_argument("--asc", action="store_true", help="rank in ascending order")
+    cmd.add_argument("--limit", type=int, default=10)
+    cmd.add_argument("--mode")
+    cmd.add_argument("--year", type=int)
+    cmd.add_argument("--deposit", type=float)
+    cmd.add_argument("--spread", type=int)
+    cmd = sub.add_parser("diff", help="compare two runs")
+    cmd.add_argument("run1", type=int)
+    cmd.add_argument("run2", type=int)
+    args = parser.parse_args()
+    db = connect(args.db)
+    if args.command == "ingest":
+        print("Ingested {} report(s).".format(ingest(db, args.root)))
+    elif args.command == "rank":
+        rank(db, args)
+    else:
+        diff(db, args)
+
+
+if __name__ == "__main__":
+    main()
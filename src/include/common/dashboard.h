@@ -0,0 +1,151 @@
+//+------------------------------------------------------------------+
+//|                  EA31337 - multi-strategy advanced trading robot |
+//|                                 Copyright 2016-2024, EA31337 Ltd |
+//|                                       https://github.com/EA31337 |
+//+------------------------------------------------------------------+
+
+/*
+ *  This file is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Chart details rendered at a bounded rate from cached sections.
+ */
+
+// Prevents processing this includes file multiple times.
+#ifndef EA_DASHBOARD_H
+#define EA_DASHBOARD_H
+
+// Defines.
+#define EA_DASHBOARD_BUFFER_SIZE 16384  // Initial size of the output buffer.
+#define EA_DASHBOARD_KEY_MAIN 0         // Key of the main (EA) section.
+
+/**
+ * Keeps chart details as separate sections, so only changed ones need to be serialized again.
+ */
+class EADashboard {
+ protected:
+  bool changed;           // Whether any section has changed since the last render.
+  bool dirty;             // Whether the main section needs to be updated.
+  datetime bar_times[];   // Bar time of the last section's update.
+  string sections[];      // Cached sections (in order of adding).
+  Dict<long, int> index;  // Maps section key into its index.
+  string header;          // Text printed before sections.
+  string text;            // Output buffer.
+  uint last_render;       // Time of the last render (in ms).
+  uint refresh;           // Minimum interval between renders (in ms).
+
+  /**
+   * Gets index of the section, adds a new one when missing.
+   */
+  int GetIndex(long _key) {
+    if (index.KeyExists(_key)) {
+      return index.GetByKey(_key);
+    }
+    int _index = ArraySize(sections);
+    ArrayResize(sections, _index + 1, 10);
+    ArrayResize(bar_times, _index + 1, 10);
+    sections[_index] = "";
+    bar_times[_index] = 0;
+    index.Set(_key, _index);
+    return _index;
+  }
+
+ public:
+  /**
+   * Class constructor.
+   *
+   * @param
+   *   _refresh - minimum interval between renders (in ms)
+   */
+  EADashboard(uint _refresh = 1000) : changed(false), dirty(false), last_render(0), refresh(_refresh) {
+#ifdef __MQL5__
+    StringReserve(text, EA_DASHBOARD_BUFFER_SIZE);
+#endif
+    GetIndex(EA_DASHBOARD_KEY_MAIN);
+  }
+
+  /* Getters */
+
+  /**
+   * Checks whether the main section needs to be updated.
+   */
+  bool IsDirty() { return dirty; }
+
+  /**
+   * Checks whether the section needs to be updated for the given bar time.
+   */
+  bool IsDirty(long _key, datetime _bar_time) { return bar_times[GetIndex(_key)] != _bar_time; }
+
+  /**
+   * Checks whether there is something new to render and the refresh interval has passed.
+   */
+  bool IsDue() { return (changed || dirty) && GetTickCount() - last_render >= refresh; }
+
+  /* Setters */
+
+  /**
+   * Marks the main section to be updated on the next render.
+   */
+  void SetDirty(bool _dirty = true) { dirty = _dirty; }
+
+  /**
+   * Sets text printed before sections.
+   */
+  void SetHeader(string _header) {
+    header = _header;
+    changed = true;
+  }
+
+  /**
+   * Sets the main section.
+   */
+  void SetSection(string _text) {
+    SetSection(EA_DASHBOARD_KEY_MAIN, _text);
+    dirty = false;
+  }
+
+  /**
+   * Sets the section for the given key.
+   */
+  void SetSection(long _key, string _text, datetime _bar_time = 0) {
+    int _index = GetIndex(_key);
+    sections[_index] = _text;
+    bar_times[_index] = _bar_time;
+    changed = true;
+  }
+
+  /**
+   * Renders all sections into the output buffer.
+   *
+   * @param
+   *   _footer - text printed after sections
+   *
+   * @return
+   *   Returns rendered text.
+   */
+  string Render(string _footer = "") {
+    text = header;
+    for (int _i = 0; _i < ArraySize(sections); _i++) {
+      text += sections[_i];
+    }
+    text += _footer;
+    changed = false;
+    last_render = GetTickCount();
+    return text;
+  }
+};
+
+#endif  // EA_DASHBOARD_H
@@ -42,6 +42,9 @@
 #endif                       // __backtest__
 #define ea_exists (ea_name[0] == 69)
 
+// Minimum interval between chart details updates (in ms).
+#define ea_dashboard_refresh 1000
+
 // Strategy defines.
 #define STG_PATH "strats"
 #ifdef __MQL4__
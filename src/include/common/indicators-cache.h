@@ -0,0 +1,119 @@
+//+------------------------------------------------------------------+
+//|                  EA31337 - multi-strategy advanced trading robot |
+//|                                 Copyright 2016-2024, EA31337 Ltd |
+//|                                       https://github.com/EA31337 |
+//+------------------------------------------------------------------+
+
+/*
+ *  This file is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Indicators shared between strategies (enabled by __indi_shared__).
+ */
+
+// Prevents processing this includes file multiple times.
+#ifndef EA_INDICATORS_CACHE_H
+#define EA_INDICATORS_CACHE_H
+
+/**
+ * Keeps one instance of each distinct indicator, so strategies using identical ones share it.
+ *
+ * Indicators are identified by their full name, symbol, timeframe and serialized params,
+ * since the full name does not include params (e.g. periods) of the indicator.
+ * Lookups happen only when strategies are added, so string keys are fine here.
+ */
+class EAIndicatorsCache {
+ protected:
+  DictStruct<string, Ref<IndicatorData>> indis;
+  int shared;  // Number of indicators replaced by the shared ones.
+
+ public:
+  /**
+   * Class constructor.
+   */
+  EAIndicatorsCache() : shared(0) {}
+
+  /**
+   * Gets key of the indicator.
+   *
+   * Typed params are reachable only through the indicator's serialization (IndicatorData does not expose them),
+   * so only its default fields are serialized, leaving out runtime and buffer state.
+   */
+  string GetKey(IndicatorData *_indi) {
+    return StringFormat("%s@%s:%d", _indi.GetFullName(), _indi.GetSymbol(), (int)_indi.GetTf()) +
+           SerializerConverter::FromObject(_indi, SERIALIZER_FLAG_INCLUDE_DEFAULT)
+               .ToString<SerializerJson>(SERIALIZER_JSON_NO_WHITESPACES);
+  }
+
+  /**
+   * Gets the shared indicator identical to the given one.
+   *
+   * @return
+   *   Returns the shared instance, or the given one when it is the first of its kind.
+   */
+  IndicatorData *Share(IndicatorData *_indi) {
+    string _key = GetKey(_indi);
+    if (indis.KeyExists(_key)) {
+      return indis.GetByKey(_key).Ptr();
+    }
+    Ref<IndicatorData> _ref = _indi;
+    indis.Set(_key, _ref);
+    return _indi;
+  }
+
+  /**
+   * Replaces strategy's indicators with the shared ones.
+   *
+   * @return
+   *   Returns number of replaced indicators.
+   */
+  int Share(Strategy *_strat) {
+    int _ids[];
+    IndicatorData *_shared[];
+    for (DictStructIterator<int, Ref<IndicatorData>> _iter = _strat.GetIndicators().Begin(); _iter.IsValid();
+         ++_iter) {
+      IndicatorData *_indi = _iter.Value().Ptr();
+      IndicatorData *_indi_shared = _indi != NULL ? Share(_indi) : NULL;
+      if (_indi_shared != NULL && _indi_shared != _indi) {
+        int _size = ArraySize(_ids);
+        ArrayResize(_ids, _size + 1);
+        ArrayResize(_shared, _size + 1);
+        _ids[_size] = _iter.Key();
+        _shared[_size] = _indi_shared;
+      }
+    }
+    // Strategy's indicators are replaced after iterating over them.
+    for (int _i = 0; _i < ArraySize(_ids); _i++) {
+      _strat.SetIndicator(_shared[_i], _ids[_i]);
+    }
+    shared += ArraySize(_ids);
+    return ArraySize(_ids);
+  }
+
+  /* Getters */
+
+  /**
+   * Gets number of distinct indicators.
+   */
+  int GetSize() { return indis.Size(); }
+
+  /**
+   * Gets number of indicators replaced by the shared ones.
+   */
+  int GetShared() { return shared; }
+};
+
+#endif  // EA_INDICATORS_CACHE_H
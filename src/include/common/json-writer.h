@@ -0,0 +1,205 @@
+//+------------------------------------------------------------------+
+//|                  EA31337 - multi-strategy advanced trading robot |
+//|                                 Copyright 2016-2024, EA31337 Ltd |
+//|                                       https://github.com/EA31337 |
+//+------------------------------------------------------------------+
+
+/*
+ *  This file is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Streaming JSON writer.
+ */
+
+// Prevents processing this includes file multiple times.
+#ifndef EA_JSON_WRITER_H
+#define EA_JSON_WRITER_H
+
+/**
+ * Writes compact JSON directly into a reusable buffer, without building a tree of nodes.
+ *
+ * The buffer keeps its capacity between documents. When a file is set,
+ * the buffer is flushed into it once it grows over the flush size.
+ */
+class EAJsonWriter {
+ protected:
+  string buffer;
+  int handle;      // File to flush into (INVALID_HANDLE to keep the output in the buffer).
+  int flush_size;  // Size of the buffer to flush at.
+  bool is_first;   // Whether the next value is the first one of its container.
+
+  /**
+   * Appends the separator and the key of the next value.
+   */
+  void Next(string _key) {
+    if (!is_first) {
+      StringAdd(buffer, ",");
+    }
+    is_first = false;
+    if (_key != NULL) {
+      AddEscaped(_key);
+      StringAdd(buffer, ":");
+    }
+  }
+
+  /**
+   * Appends the quoted and escaped string.
+   *
+   * Quotes, backslashes and control characters (below 0x20) are escaped.
+   */
+  void AddEscaped(string _value) {
+    StringAdd(buffer, "\"");
+    int _len = StringLen(_value);
+    int _start = 0;
+    for (int _i = 0; _i < _len; _i++) {
+      ushort _char = StringGetCharacter(_value, _i);
+      if (_char >= 0x20 && _char != '"' && _char != '\\') {
+        continue;
+      }
+      // Copies the part which doesn't need escaping at once.
+      if (_i > _start) {
+        StringAdd(buffer, StringSubstr(_value, _start, _i - _start));
+      }
+      _start = _i + 1;
+      switch (_char) {
+        case '"':
+          StringAdd(buffer, "\\\"");
+          break;
+        case '\\':
+          StringAdd(buffer, "\\\\");
+          break;
+        case '\n':
+          StringAdd(buffer, "\\n");
+          break;
+        case '\r':
+          StringAdd(buffer, "\\r");
+          break;
+        case '\t':
+          StringAdd(buffer, "\\t");
+          break;
+        default:
+          StringAdd(buffer, StringFormat("\\u%04X", _char));
+          break;
+      }
+    }
+    StringAdd(buffer, _start == 0 ? _value : StringSubstr(_value, _start));
+    StringAdd(buffer, "\"");
+  }
+
+ public:
+  /**
+   * Class constructor.
+   *
+   * @param
+   *   _reserve - initial capacity of the buffer (in characters)
+   */
+  EAJsonWriter(int _reserve = 4096) : handle(INVALID_HANDLE), flush_size(0), is_first(true) {
+    StringReserve(buffer, _reserve);
+  }
+
+  /**
+   * Sets file to flush the output into.
+   */
+  void SetFile(int _handle, int _flush_size = 1 << 16) {
+    handle = _handle;
+    flush_size = _flush_size;
+  }
+
+  /**
+   * Clears the buffer (keeping its capacity) to start a new document.
+   */
+  void Reset() {
+    StringSetLength(buffer, 0);
+    is_first = true;
+  }
+
+  /**
+   * Ends the document in the file output (as a line of JSON lines).
+   */
+  void EndLine() {
+    StringAdd(buffer, "\n");
+    is_first = true;
+    if (handle != INVALID_HANDLE && StringLen(buffer) >= flush_size) {
+      Flush();
+    }
+  }
+
+  /**
+   * Writes the buffer into the file.
+   */
+  bool Flush() {
+    if (handle == INVALID_HANDLE) {
+      return false;
+    }
+    bool _result = StringLen(buffer) == 0 || FileWriteString(handle, buffer) > 0;
+    StringSetLength(buffer, 0);
+    return _result;
+  }
+
+  /* Writers */
+
+  void BeginObject(string _key = NULL) {
+    Next(_key);
+    StringAdd(buffer, "{");
+    is_first = true;
+  }
+
+  void EndObject() {
+    StringAdd(buffer, "}");
+    is_first = false;
+  }
+
+  void BeginArray(string _key = NULL) {
+    Next(_key);
+    StringAdd(buffer, "[");
+    is_first = true;
+  }
+
+  void EndArray() {
+    StringAdd(buffer, "]");
+    is_first = false;
+  }
+
+  void AddString(string _key, string _value) {
+    Next(_key);
+    AddEscaped(_value);
+  }
+
+  void AddInt(string _key, long _value) {
+    Next(_key);
+    StringAdd(buffer, IntegerToString(_value));
+  }
+
+  void AddDouble(string _key, double _value, int _digits = 2) {
+    Next(_key);
+    // JSON has no representation of NaN nor infinity.
+    StringAdd(buffer, MathIsValidNumber(_value) ? DoubleToString(_value, _digits) : "null");
+  }
+
+  void AddBool(string _key, bool _value) {
+    Next(_key);
+    StringAdd(buffer, _value ? "true" : "false");
+  }
+
+  /* Getters */
+
+  /**
+   * Gets the output kept in the buffer.
+   */
+  string ToString() { return buffer; }
+};
+
+#endif  // EA_JSON_WRITER_H
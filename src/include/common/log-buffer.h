@@ -0,0 +1,218 @@
+//+------------------------------------------------------------------+
+//|                  EA31337 - multi-strategy advanced trading robot |
+//|                                 Copyright 2016-2024, EA31337 Ltd |
+//|                                       https://github.com/EA31337 |
+//+------------------------------------------------------------------+
+
+/*
+ *  This file is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Log messages buffered and printed in batches.
+ */
+
+// Prevents processing this includes file multiple times.
+#ifndef EA_LOG_BUFFER_H
+#define EA_LOG_BUFFER_H
+
+// Defines.
+#define EA_LOG_BUFFER_SIZE 256  // Number of records kept until the flush.
+
+// Log record.
+struct EALogRecord {
+  ENUM_LOG_LEVEL level;  // Level of the message.
+  datetime time;         // Time of adding.
+  string msg;            // Message.
+  string loc;            // Code location.
+};
+
+/**
+ * Keeps log records in a ring buffer, so they are printed in batches (e.g. on timer)
+ * instead of on the tick which added them.
+ *
+ * Callers check IsEnabled() before formatting, so records above the verbosity level cost nothing,
+ * records over the per-level rate limit (per minute) are counted and reported as suppressed.
+ * Printed records stay in the ring until overwritten, so the latest ones can be shown on the chart.
+ */
+class EALogBuffer {
+ protected:
+  EALogRecord records[EA_LOG_BUFFER_SIZE];
+  int head;    // Index of the oldest record to print.
+  int size;    // Number of records to print.
+  int stored;  // Number of records in the ring (including printed ones).
+  ENUM_LOG_LEVEL level;
+  int limits[];      // Max records per minute per level (0 = no limit).
+  int counts[];      // Records added in the current minute per level.
+  int suppressed[];  // Records suppressed since the last flush per level.
+  int minute;        // Minute of counting.
+
+  /**
+   * Gets name of the level.
+   */
+  string GetLevelName(ENUM_LOG_LEVEL _level) {
+    switch (_level) {
+      case V_ERROR:
+        return "Error";
+      case V_WARNING:
+        return "Warning";
+      case V_INFO:
+        return "Info";
+      case V_DEBUG:
+        return "Debug";
+      case V_TRACE:
+        return "Trace";
+      default:
+        break;
+    }
+    return "";
+  }
+
+ public:
+  /**
+   * Class constructor.
+   */
+  EALogBuffer(ENUM_LOG_LEVEL _level = V_INFO) : head(0), size(0), stored(0), level(_level), minute(0) {
+    ArrayResize(limits, V_TRACE + 1);
+    ArrayResize(counts, V_TRACE + 1);
+    ArrayResize(suppressed, V_TRACE + 1);
+    ArrayInitialize(limits, 0);
+    ArrayInitialize(counts, 0);
+    ArrayInitialize(suppressed, 0);
+    limits[V_WARNING] = 60;
+    limits[V_INFO] = 30;
+    limits[V_DEBUG] = 30;
+    limits[V_TRACE] = 30;
+  }
+
+  /**
+   * Class destructor.
+   */
+  ~EALogBuffer() { Flush(); }
+
+  /**
+   * Adds the record.
+   *
+   * @return
+   *   Returns true when the record has been added, false when rejected by its level or rate limit.
+   */
+  bool Add(ENUM_LOG_LEVEL _level, string _msg, string _loc = "") {
+    if (!IsEnabled(_level)) {
+      return false;
+    }
+    datetime _time = TimeCurrent();
+    if (minute != (int)(_time / 60)) {
+      minute = (int)(_time / 60);
+      ArrayInitialize(counts, 0);
+    }
+    if (limits[_level] > 0 && counts[_level] >= limits[_level]) {
+      suppressed[_level]++;
+      return false;
+    }
+    counts[_level]++;
+    if (size == EA_LOG_BUFFER_SIZE) {
+      // Buffer is full, so it is printed earlier.
+      Flush();
+    }
+    int _index = (head + size++) % EA_LOG_BUFFER_SIZE;
+    records[_index].level = _level;
+    records[_index].time = _time;
+    records[_index].msg = _msg;
+    records[_index].loc = _loc;
+    stored = stored < EA_LOG_BUFFER_SIZE ? stored + 1 : stored;
+    return true;
+  }
+
+  bool Error(string _msg, string _loc = "") { return Add(V_ERROR, _msg, _loc); }
+  bool Warning(string _msg, string _loc = "") { return Add(V_WARNING, _msg, _loc); }
+  bool Info(string _msg, string _loc = "") { return Add(V_INFO, _msg, _loc); }
+  bool Debug(string _msg, string _loc = "") { return Add(V_DEBUG, _msg, _loc); }
+
+  /**
+   * Adds the error record and prints it immediately (e.g. before breaking the execution).
+   */
+  bool Fatal(string _msg, string _loc = "") {
+    bool _result = Add(V_ERROR, _msg, _loc);
+    Flush();
+    return _result;
+  }
+
+  /**
+   * Prints buffered records and counts of suppressed ones.
+   *
+   * @return
+   *   Returns number of printed records.
+   */
+  int Flush() {
+    int _count = size;
+    for (; size > 0; size--) {
+      PrintFormat("%s: %s: %s%s", TimeToString(records[head].time, TIME_DATE | TIME_SECONDS),
+                  GetLevelName(records[head].level), records[head].msg,
+                  records[head].loc != "" ? " (" + records[head].loc + ")" : "");
+      head = (head + 1) % EA_LOG_BUFFER_SIZE;
+    }
+    for (int _level = V_ERROR; _level <= V_TRACE; _level++) {
+      if (suppressed[_level] > 0) {
+        PrintFormat("%s: %d message(s) suppressed by the rate limit.", GetLevelName((ENUM_LOG_LEVEL)_level),
+                    suppressed[_level]);
+        suppressed[_level] = 0;
+      }
+    }
+    return _count;
+  }
+
+  /* Setters */
+
+  /**
+   * Sets verbosity level.
+   */
+  void SetLevel(ENUM_LOG_LEVEL _level) { level = _level; }
+
+  /**
+   * Sets max records per minute of the level (0 = no limit).
+   */
+  void SetRateLimit(ENUM_LOG_LEVEL _level, int _per_minute) { limits[_level] = _per_minute; }
+
+  /* Getters */
+
+  /**
+   * Checks whether records of the level are kept (to skip formatting of rejected messages).
+   */
+  bool IsEnabled(ENUM_LOG_LEVEL _level) { return _level > V_NONE && _level <= level; }
+
+  /**
+   * Gets number of buffered records.
+   */
+  int GetSize() { return size; }
+
+  /**
+   * Gets the latest records (printed or not) as text, one per line.
+   *
+   * @param
+   *   _count - max number of records to get
+   */
+  string ToString(int _count = 10) {
+    string _output = "";
+    _count = _count < stored ? _count : stored;
+    int _last = head + size - 1;
+    for (int _i = _last - _count + 1; _i <= _last; _i++) {
+      int _index = (_i + EA_LOG_BUFFER_SIZE) % EA_LOG_BUFFER_SIZE;
+      StringAdd(_output, StringFormat("%s: %s\n", GetLevelName(records[_index].level), records[_index].msg));
+    }
+    return _output;
+  }
+};
+
+#endif  // EA_LOG_BUFFER_H
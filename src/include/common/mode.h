@@ -17,11 +17,17 @@
 // #define __backtest__     // For backtest only.
 // #define __cli__          // Enables CLI mode.
 // #define __debug__        // Enables debugging.
+// #define __ea_profiler__  // Activates EA's per-tick and per-strategy cost accounting.
+// #define __indi_shared__  // Shares identical indicators between strategies.
 // #define __input__        // Enables user input params.
+// #define __lazy__         // Enables lazy initialization of strategies.
 // #define __limited__      // Defines safe options.
 // #define __optimize__     // Optimization mode.
 // #define __profiler__     // Activates profiler.
 // #define __property__     // Enables program properties.
 // #define __release__      // Enables release settings.
 // #define __resource__     // Enables resources.
+// #define __signals_net__  // Nets strategies' signals into one order per direction (per tick).
+// #define __sweep__        // Enables parameter sweep from a file (tester only).
+// #define __tick_bench__   // Enables benchmark of OnTick() calls with ticks from a file (tester only).
 // #define __trace__        // Enables tracing.
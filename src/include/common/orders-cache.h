@@ -0,0 +1,275 @@
+//+------------------------------------------------------------------+
+//|                  EA31337 - multi-strategy advanced trading robot |
+//|                                 Copyright 2016-2024, EA31337 Ltd |
+//|                                       https://github.com/EA31337 |
+//+------------------------------------------------------------------+
+
+/*
+ *  This file is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Open positions' state kept up to date from trade transactions (MQL5 only).
+ */
+
+// Prevents processing this includes file multiple times.
+#ifndef EA_ORDERS_CACHE_H
+#define EA_ORDERS_CACHE_H
+
+// Ranks of open positions by their profit.
+enum ENUM_EA_ORDERS_CACHE_RANK {
+  EA_ORDERS_CACHE_RANK_MOST_LOSS,     // Position with the most loss.
+  EA_ORDERS_CACHE_RANK_MOST_PROFIT,   // Position with the most profit.
+  EA_ORDERS_CACHE_RANK_LEAST_LOSS,    // Position with the least loss.
+  EA_ORDERS_CACHE_RANK_LEAST_PROFIT,  // Position with the least profit.
+};
+
+/**
+ * Cached open position.
+ */
+struct EAOrdersCachePosition {
+  ulong ticket;
+  long magic_no;
+  int side;  // 0 for buy, 1 for sell.
+  double volume;
+  double price_open;
+};
+
+/**
+ * Keeps open positions of the symbol.
+ *
+ * The cache is updated only on trade transactions, so reading it costs nothing per tick.
+ */
+class EAOrdersCache {
+ protected:
+  string symbol;
+  Trade *trade;      // Trade of the symbol used to close positions.
+  EALogBuffer *log;  // Log to report failures into.
+  EAOrdersCachePosition positions[];
+  Dict<long, int> positions_index;  // Maps position ticket into index of positions.
+  Dict<long, int> magics_owned;     // Magic numbers of EA's strategies (all positions when empty).
+  ulong version;                    // Incremented on each change of positions.
+
+  /**
+   * Removes the position from the cache.
+   */
+  void RemovePosition(ulong _ticket) {
+    if (!positions_index.KeyExists((long)_ticket)) {
+      return;
+    }
+    int _index = positions_index.GetByKey((long)_ticket);
+    int _last = ArraySize(positions) - 1;
+    if (_index != _last) {
+      positions[_index] = positions[_last];
+      positions_index.Set((long)positions[_index].ticket, _index);
+    }
+    ArrayResize(positions, _last);
+    positions_index.Unset((long)_ticket);
+    version++;
+  }
+
+  /**
+   * Stores the currently selected position in the cache.
+   */
+  void SetPosition(ulong _ticket) {
+    int _index;
+    if (positions_index.KeyExists((long)_ticket)) {
+      _index = positions_index.GetByKey((long)_ticket);
+    } else {
+      _index = ArraySize(positions);
+      ArrayResize(positions, _index + 1, 20);
+      positions_index.Set((long)_ticket, _index);
+    }
+    positions[_index].ticket = _ticket;
+    positions[_index].magic_no = PositionGetInteger(POSITION_MAGIC);
+    positions[_index].side = PositionGetInteger(POSITION_TYPE) == POSITION_TYPE_BUY ? 0 : 1;
+    positions[_index].volume = PositionGetDouble(POSITION_VOLUME);
+    positions[_index].price_open = PositionGetDouble(POSITION_PRICE_OPEN);
+    version++;
+  }
+
+ public:
+  /**
+   * Class constructor.
+   */
+  EAOrdersCache(string _symbol = NULL)
+      : symbol(_symbol == NULL ? _Symbol : _symbol), trade(NULL), log(NULL), version(0) {}
+
+  /**
+   * Adds magic number of EA's strategy to ones considered for selecting by profit and closing.
+   */
+  void AddMagicNo(long _magic_no) { magics_owned.Set(_magic_no, 1); }
+
+  /**
+   * Closes the position through the trade of the symbol.
+   *
+   * So the trade's configured slippage and filling mode are used.
+   */
+  bool ClosePosition(ulong _ticket, ENUM_ORDER_REASON_CLOSE _reason = ORDER_REASON_CLOSED_BY_ACTION) {
+    bool _result = false;
+    if (trade != NULL && trade.GetOrdersActive().KeyExists((long)_ticket)) {
+      Ref<Order> _order = trade.GetOrdersActive().GetByKey((long)_ticket);
+      _result = _order.IsSet() && _order.Ptr().OrderClose(_reason);
+    } else if (PositionSelectByTicket(_ticket)) {
+      // Position is not tracked by the trade, so it is closed by its ticket.
+      Order _order((long)_ticket);
+      _result = _order.OrderClose(_reason);
+    }
+    if (!_result && log != NULL && log.IsEnabled(V_ERROR)) {
+      log.Error(StringFormat("Cannot close position #%s of %s (error: %d)!", (string)_ticket, symbol, GetLastError()),
+                __FUNCTION_LINE__);
+    }
+    return _result;
+  }
+
+  /**
+   * Closes positions of the side opened by the given strategies.
+   *
+   * @param
+   *   _side - 0 for buy, 1 for sell
+   *   _magic_nos - magic numbers of strategies to close positions of
+   *   _reason - reason of closing
+   *
+   * @return
+   *   Returns number of closed positions.
+   */
+  int CloseSide(int _side, Dict<long, int> &_magic_nos,
+                ENUM_ORDER_REASON_CLOSE _reason = ORDER_REASON_CLOSED_BY_SIGNAL) {
+    ulong _tickets[];
+    int _count = 0;
+    // Tickets are copied, since positions are removed on trade transactions.
+    for (int _i = 0; _i < ArraySize(positions); _i++) {
+      if (positions[_i].side == _side && _magic_nos.KeyExists(positions[_i].magic_no)) {
+        ArrayResize(_tickets, _count + 1, ArraySize(positions));
+        _tickets[_count++] = positions[_i].ticket;
+      }
+    }
+    _count = 0;
+    for (int _i = 0; _i < ArraySize(_tickets); _i++) {
+      _count += ClosePosition(_tickets[_i], _reason) ? 1 : 0;
+    }
+    return _count;
+  }
+
+  /**
+   * Rebuilds the cache from all open positions.
+   */
+  void Refresh() {
+    ArrayResize(positions, 0, 20);
+    positions_index.Clear();
+    version++;
+    for (int _i = 0; _i < PositionsTotal(); _i++) {
+      ulong _ticket = PositionGetTicket(_i);
+      if (_ticket > 0 && PositionGetString(POSITION_SYMBOL) == symbol) {
+        SetPosition(_ticket);
+      }
+    }
+  }
+
+  /**
+   * Updates the cache on trade transaction.
+   */
+  void OnTradeTransaction(const MqlTradeTransaction &_trans) {
+    if (_trans.type != TRADE_TRANSACTION_DEAL_ADD || _trans.symbol != symbol) {
+      return;
+    }
+    ulong _ticket = _trans.position;
+    if (PositionSelectByTicket(_ticket)) {
+      // Position has been opened or partially closed.
+      SetPosition(_ticket);
+    } else {
+      RemovePosition(_ticket);
+    }
+  }
+
+  /* Setters */
+
+  /**
+   * Sets symbol of positions (the cache needs to be refreshed afterwards).
+   */
+  void SetSymbol(string _symbol) { symbol = _symbol; }
+
+  /**
+   * Sets trade of the symbol used to close positions.
+   */
+  void SetTrade(Trade *_trade) { trade = _trade; }
+
+  /**
+   * Sets log to report failures into.
+   */
+  void SetLogBuffer(EALogBuffer *_log) { log = _log; }
+
+  /* Getters */
+
+  /**
+   * Checks whether the magic number belongs to EA's strategies.
+   */
+  bool IsOwned(long _magic_no) { return magics_owned.Size() == 0 || magics_owned.KeyExists(_magic_no); }
+
+  /**
+   * Gets number of all open positions.
+   */
+  int GetCount() { return ArraySize(positions); }
+
+  /**
+   * Gets version of the cache, which changes on each change of positions.
+   */
+  ulong GetVersion() { return version; }
+
+  /**
+   * Gets ticket of the open position by its profit rank.
+   *
+   * @return
+   *   Returns ticket, or 0 when there is no such position.
+   */
+  ulong GetByProfit(ENUM_EA_ORDERS_CACHE_RANK _rank) {
+    double _bid = SymbolInfoDouble(symbol, SYMBOL_BID);
+    double _ask = SymbolInfoDouble(symbol, SYMBOL_ASK);
+    ulong _ticket = 0;
+    double _best = 0;
+    // Positions are selected in one pass, as prices change the order of them on each tick.
+    for (int _i = 0; _i < ArraySize(positions); _i++) {
+      if (!IsOwned(positions[_i].magic_no)) {
+        // Ignores positions not opened by the EA.
+        continue;
+      }
+      // Volume-weighted price difference has the same order as the profit of the same symbol.
+      double _profit = positions[_i].side == 0 ? (_bid - positions[_i].price_open) * positions[_i].volume
+                                               : (positions[_i].price_open - _ask) * positions[_i].volume;
+      bool _is_better = false;
+      switch (_rank) {
+        case EA_ORDERS_CACHE_RANK_MOST_LOSS:
+          _is_better = _profit < 0 && (_ticket == 0 || _profit < _best);
+          break;
+        case EA_ORDERS_CACHE_RANK_MOST_PROFIT:
+          _is_better = _profit > 0 && (_ticket == 0 || _profit > _best);
+          break;
+        case EA_ORDERS_CACHE_RANK_LEAST_LOSS:
+          _is_better = _profit < 0 && (_ticket == 0 || _profit > _best);
+          break;
+        case EA_ORDERS_CACHE_RANK_LEAST_PROFIT:
+          _is_better = _profit > 0 && (_ticket == 0 || _profit < _best);
+          break;
+      }
+      if (_is_better) {
+        _ticket = positions[_i].ticket;
+        _best = _profit;
+      }
+    }
+    return _ticket;
+  }
+};
+
+#endif  // EA_ORDERS_CACHE_H
@@ -0,0 +1,198 @@
+//+------------------------------------------------------------------+
+//|                  EA31337 - multi-strategy advanced trading robot |
+//|                                 Copyright 2016-2024, EA31337 Ltd |
+//|                                       https://github.com/EA31337 |
+//+------------------------------------------------------------------+
+
+/*
+ *  This file is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Per-tick and per-strategy cost accounting (enabled by __ea_profiler__).
+ */
+
+// Prevents processing this includes file multiple times.
+#ifndef EA_PROFILER_H
+#define EA_PROFILER_H
+
+// Defines.
+#define EA_PROFILER_BUCKETS 32  // Number of log2 buckets (up to ~35 minutes in microseconds).
+
+/**
+ * Latency histogram with log2-sized buckets (in microseconds).
+ */
+struct EAProfilerHistogram {
+  long buckets[EA_PROFILER_BUCKETS];
+  long count;
+  long sum;
+  long max;
+
+  // Struct constructor.
+  EAProfilerHistogram() { Reset(); }
+
+  /**
+   * Resets the histogram.
+   */
+  void Reset() {
+    for (int _i = 0; _i < EA_PROFILER_BUCKETS; _i++) {
+      buckets[_i] = 0;
+    }
+    count = 0;
+    sum = 0;
+    max = 0;
+  }
+
+  /**
+   * Adds a new sample.
+   */
+  void Add(long _usec) {
+    int _bucket = 0;
+    for (long _value = _usec; _value > 1 && _bucket < EA_PROFILER_BUCKETS - 1; _value >>= 1) {
+      _bucket++;
+    }
+    buckets[_bucket]++;
+    count++;
+    sum += _usec;
+    max = _usec > max ? _usec : max;
+  }
+
+  /**
+   * Gets the upper bound of the bucket containing the given percentile.
+   */
+  long GetPercentile(double _pc) {
+    long _limit = (long)ceil(count * _pc / 100.0);
+    long _total = 0;
+    for (int _i = 0; _i < EA_PROFILER_BUCKETS; _i++) {
+      _total += buckets[_i];
+      if (_total >= _limit && _total > 0) {
+        return (long)1 << (_i + 1);
+      }
+    }
+    return max;
+  }
+
+  /**
+   * Returns textual representation of the histogram.
+   */
+  string ToString() {
+    string _output = StringFormat("n=%d, avg=%.1fus, p50<%dus, p90<%dus, p99<%dus, max=%dus", count,
+                                  count > 0 ? (double)sum / count : 0, GetPercentile(50), GetPercentile(90),
+                                  GetPercentile(99), max);
+    _output += ", buckets=[";
+    for (int _i = 0; _i < EA_PROFILER_BUCKETS; _i++) {
+      if (buckets[_i] > 0) {
+        _output += StringFormat(" <%dus:%d", (long)1 << (_i + 1), buckets[_i]);
+      }
+    }
+    return _output + " ]";
+  }
+};
+
+/**
+ * Per-strategy profiling counters.
+ */
+struct EAProfilerStrategy {
+  long magic_no;
+  string name;
+  long signals;             // Number of evaluated signals.
+  int indicators_attached;  // Number of indicators attached to the strategy (not their fetches).
+  long order_ops;           // Number of sent order requests.
+  EAProfilerHistogram hist;
+
+  // Struct constructor.
+  EAProfilerStrategy() : magic_no(0), signals(0), indicators_attached(0), order_ops(0) {}
+
+  /**
+   * Returns textual representation of the counters.
+   */
+  string ToString() {
+    return StringFormat("%s (%d): signals=%d, indicators_attached=%d, order_ops=%d, %s", name, magic_no, signals,
+                        indicators_attached, order_ops, hist.ToString());
+  }
+};
+
+/**
+ * Collects tick and strategy costs.
+ */
+class EAProfiler {
+ protected:
+  EAProfilerHistogram tick;
+  EAProfilerStrategy strats[];
+  Dict<long, int> strats_index;  // Maps magic number into index of strats.
+  long order_ops;
+
+  /**
+   * Gets index of the strategy counters, adds a new entry when missing.
+   *
+   * The name is built only once, when the entry is added.
+   */
+  int GetStrategyIndex(Strategy *_strat) {
+    long _magic_no = _strat.Get<long>(STRAT_PARAM_ID);
+    if (strats_index.KeyExists(_magic_no)) {
+      return strats_index.GetByKey(_magic_no);
+    }
+    int _index = ArraySize(strats);
+    ArrayResize(strats, _index + 1, 10);
+    strats[_index].magic_no = _magic_no;
+    strats[_index].name =
+        StringFormat("%s@%s", _strat.GetName(), ChartTf::TfToString(_strat.Get<ENUM_TIMEFRAMES>(STRAT_PARAM_TF)));
+    strats[_index].indicators_attached = _strat.GetIndicators().Size();
+    strats_index.Set(_magic_no, _index);
+    return _index;
+  }
+
+ public:
+  /**
+   * Class constructor.
+   */
+  EAProfiler() : order_ops(0) {}
+
+  /**
+   * Adds the time of the whole tick.
+   */
+  void AddTick(long _usec) { tick.Add(_usec); }
+
+  /**
+   * Adds the time of the strategy's signal evaluation.
+   */
+  void AddStrategy(Strategy *_strat, long _usec) {
+    int _index = GetStrategyIndex(_strat);
+    strats[_index].hist.Add(_usec);
+    strats[_index].signals++;
+  }
+
+  /**
+   * Counts order operation sent on behalf of the given magic number.
+   */
+  void AddOrderOp(long _magic_no) {
+    order_ops++;
+    if (strats_index.KeyExists(_magic_no)) {
+      strats[strats_index.GetByKey(_magic_no)].order_ops++;
+    }
+  }
+
+  /**
+   * Prints collected stats into the log.
+   */
+  void Print() {
+    ::Print("Profiler: tick: ", tick.ToString(), ", order_ops=", order_ops);
+    for (int _i = 0; _i < ArraySize(strats); _i++) {
+      ::Print("Profiler: strategy: ", strats[_i].ToString());
+    }
+  }
+};
+
+#endif  // EA_PROFILER_H
@@ -0,0 +1,208 @@
+//+------------------------------------------------------------------+
+//|                  EA31337 - multi-strategy advanced trading robot |
+//|                                 Copyright 2016-2024, EA31337 Ltd |
+//|                                       https://github.com/EA31337 |
+//+------------------------------------------------------------------+
+
+/*
+ *  This file is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Netting of strategies' signals collected during the tick.
+ */
+
+// Prevents processing this includes file multiple times.
+#ifndef EA_SIGNALS_NET_H
+#define EA_SIGNALS_NET_H
+
+// Signal of the strategy.
+struct EASignalsNetEntry {
+  long magic_no;   // Magic number of the strategy.
+  float open;      // Open signal (1 for buy, -1 for sell, 0 for none).
+  float close;     // Close signal (1 for buys, -1 for sells, 0 for none).
+  float strength;  // Weight of the signal.
+};
+
+/**
+ * Collects signals of all strategies processed during the tick into a compact vector,
+ * then nets them into at most one close and one open operation per direction.
+ *
+ * Signal filters (see: STRAT_PARAM_SOFM, STRAT_PARAM_SCFM, STRAT_PARAM_SOFT) are already applied
+ * by signal flags of the entry, so the filtered signals are ignored on adding.
+ */
+class EASignalsNet {
+ protected:
+  EASignalsNetEntry entries[];
+  TradeSignalEntry signals[];  // Collected entries (by index of the compact entry).
+  int size;                    // Number of collected signals.
+  bool close[2];               // Whether to close positions per side (0 for buy, 1 for sell).
+  int open_cmd;                // Order type to open (-1 for none).
+  int open_index;              // Index of the strategy's entry to open the order by (-1 for none).
+
+ public:
+  /**
+   * Class constructor.
+   */
+  EASignalsNet() : size(0), open_cmd(-1), open_index(-1) {
+    ArrayResize(entries, 0, FINAL_ENUM_TIMEFRAMES_INDEX);
+    ArrayResize(signals, 0, FINAL_ENUM_TIMEFRAMES_INDEX);
+    close[0] = close[1] = false;
+  }
+
+  /**
+   * Adds signal entry of the strategy.
+   *
+   * @param
+   *   _entry - strategy's signal entry
+   *   _trade_allowed - whether the strategy is allowed to open orders (otherwise its open signal is ignored)
+   *
+   * @return
+   *   Returns true when the entry has any signal, otherwise false.
+   */
+  bool Add(TradeSignalEntry &_entry, bool _trade_allowed) {
+    TradeSignal _signal(_entry);
+    float _open = _trade_allowed ? _signal.GetSignalOpen() : 0;
+    float _close = _signal.GetSignalClose();
+    if ((_open == 0 && _close == 0) || _open == _close) {
+      // Conflicting signals are ignored the same way as by EA's signal manager.
+      return false;
+    }
+    if (size == ArraySize(entries)) {
+      ArrayResize(entries, size + 1, FINAL_ENUM_TIMEFRAMES_INDEX);
+      ArrayResize(signals, size + 1, FINAL_ENUM_TIMEFRAMES_INDEX);
+    }
+    signals[size] = _entry;
+    float _strength = (float)fabs(_entry.Get<float>(STRUCT_ENUM(TradeSignalEntry, TRADE_SIGNAL_PROP_STRENGTH)));
+    entries[size].magic_no = _entry.Get<long>(STRUCT_ENUM(TradeSignalEntry, TRADE_SIGNAL_PROP_MAGIC_ID));
+    entries[size].open = _open;
+    entries[size].close = _close;
+    entries[size].strength = _strength > 0 ? _strength : 1.0f;
+    size++;
+    return true;
+  }
+
+  /**
+   * Nets collected signals.
+   *
+   * Positions of the side are closed when weights of close signals outweigh open signals of the same side.
+   * Only positions of strategies which signaled to close the side are closed (see: GetCloseMagicNos()).
+   * The order is opened in the direction of the net weight of open signals (unless its side is being closed)
+   * by the strategy with the strongest signal in that direction (see: GetOpenEntry()).
+   *
+   * @return
+   *   Returns number of collected signals.
+   */
+  int Net() {
+    float _open_w[2] = {0, 0};
+    float _close_w[2] = {0, 0};
+    float _best_w[2] = {0, 0};
+    int _best_index[2] = {-1, -1};
+    for (int _i = 0; _i < size; _i++) {
+      if (entries[_i].open != 0) {
+        int _side = entries[_i].open > 0 ? 0 : 1;
+        _open_w[_side] += entries[_i].strength;
+        if (entries[_i].strength > _best_w[_side]) {
+          _best_w[_side] = entries[_i].strength;
+          _best_index[_side] = _i;
+        }
+      }
+      if (entries[_i].close != 0) {
+        _close_w[entries[_i].close > 0 ? 0 : 1] += entries[_i].strength;
+      }
+    }
+    close[0] = _close_w[0] > _open_w[0];
+    close[1] = _close_w[1] > _open_w[1];
+    float _net_w = _open_w[0] - _open_w[1];
+    int _side = _net_w > 0 ? 0 : 1;
+    open_cmd = -1;
+    open_index = -1;
+    if (_net_w != 0 && !close[_side]) {
+      open_cmd = _side == 0 ? ORDER_TYPE_BUY : ORDER_TYPE_SELL;
+      open_index = _best_index[_side];
+    }
+    return size;
+  }
+
+  /**
+   * Clears collected signals for the next tick (keeping the capacity).
+   */
+  void Reset() { size = 0; }
+
+  /* Getters */
+
+  /**
+   * Checks whether positions of the side should be closed.
+   *
+   * @param
+   *   _side - 0 for buy, 1 for sell
+   */
+  bool IsClose(int _side) { return close[_side]; }
+
+  /**
+   * Gets order type to open.
+   *
+   * @return
+   *   Returns ORDER_TYPE_BUY or ORDER_TYPE_SELL, otherwise -1 when there is no order to open.
+   */
+  int GetOpenCmd() { return open_cmd; }
+
+  /**
+   * Gets magic numbers of strategies which signaled to close positions of the side.
+   *
+   * @param
+   *   _side - 0 for buy, 1 for sell
+   *   _magic_nos - dictionary to fill (keyed by magic number)
+   *
+   * @return
+   *   Returns number of magic numbers.
+   */
+  int GetCloseMagicNos(int _side, Dict<long, int> &_magic_nos) {
+    _magic_nos.Clear();
+    for (int _i = 0; _i < size; _i++) {
+      if (entries[_i].close != 0 && (entries[_i].close > 0 ? 0 : 1) == _side) {
+        _magic_nos.Set(entries[_i].magic_no, 1);
+      }
+    }
+    return _magic_nos.Size();
+  }
+
+  /**
+   * Gets signal entry of the strategy to open the order by.
+   *
+   * Close signals are cleared, as closing is already netted (see: GetCloseMagicNos()).
+   *
+   * @return
+   *   Returns true when there is an order to open, otherwise false.
+   */
+  bool GetOpenEntry(TradeSignalEntry &_entry) {
+    if (open_index < 0) {
+      return false;
+    }
+    _entry = signals[open_index];
+    _entry.Set(STRUCT_ENUM(TradeSignalEntry, TRADE_SIGNAL_FLAG_CLOSE_BUY_MAIN), false);
+    _entry.Set(STRUCT_ENUM(TradeSignalEntry, TRADE_SIGNAL_FLAG_CLOSE_BUY_FILTER), false);
+    _entry.Set(STRUCT_ENUM(TradeSignalEntry, TRADE_SIGNAL_FLAG_CLOSE_SELL_MAIN), false);
+    _entry.Set(STRUCT_ENUM(TradeSignalEntry, TRADE_SIGNAL_FLAG_CLOSE_SELL_FILTER), false);
+    return true;
+  }
+
+  /**
+   * Gets number of collected signals.
+   */
+  int GetSize() { return size; }
+};
+
+#endif  // EA_SIGNALS_NET_H
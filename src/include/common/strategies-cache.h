@@ -0,0 +1,76 @@
+//+------------------------------------------------------------------+
+//|                  EA31337 - multi-strategy advanced trading robot |
+//|                                 Copyright 2016-2024, EA31337 Ltd |
+//|                                       https://github.com/EA31337 |
+//+------------------------------------------------------------------+
+
+/*
+ *  This file is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Prevents processing this includes file multiple times.
+#ifndef STRATEGIES_CACHE_H
+#define STRATEGIES_CACHE_H
+
+/**
+ * Cache of already created strategies shared by strategy managers.
+ *
+ * Strategies are stored in a flat array directly indexed by strategy type and timeframe index.
+ */
+class StrategiesCache {
+  // Cached strategies.
+  static Ref<Strategy> _cache[];
+
+ public:
+  /**
+   * Gets cache index for the given strategy type and timeframe.
+   */
+  static int GetIndex(ENUM_STRATEGY _sid, ENUM_TIMEFRAMES _tf) {
+    if (_tf == PERIOD_CURRENT) {
+      _tf = (ENUM_TIMEFRAMES)Period();
+    }
+    return (int)_sid * FINAL_ENUM_TIMEFRAMES_INDEX + (int)ChartTf::TfToIndex(_tf);
+  }
+
+  /**
+   * Returns cached strategy.
+   *
+   * @return
+   *   Returns strategy pointer when it has been cached, otherwise NULL.
+   */
+  static Strategy* Get(ENUM_STRATEGY _sid, ENUM_TIMEFRAMES _tf) {
+    int _index = GetIndex(_sid, _tf);
+    return _index < ArraySize(_cache) ? _cache[_index].Ptr() : NULL;
+  }
+
+  /**
+   * Stores strategy in the cache.
+   *
+   * Note: NULL values are not cached, so other managers can create strategies of unknown types.
+   */
+  static void Set(ENUM_STRATEGY _sid, ENUM_TIMEFRAMES _tf, Strategy* _strat) {
+    if (_strat == NULL) {
+      return;
+    }
+    int _index = GetIndex(_sid, _tf);
+    if (_index >= ArraySize(_cache)) {
+      ArrayResize(_cache, _index + 1, FINAL_ENUM_TIMEFRAMES_INDEX * 10);
+    }
+    _cache[_index] = _strat;
+  }
+};
+
+Ref<Strategy> StrategiesCache::_cache[];
+
+#endif  // STRATEGIES_CACHE_H
@@ -0,0 +1,155 @@
+//+------------------------------------------------------------------+
+//|                  EA31337 - multi-strategy advanced trading robot |
+//|                                 Copyright 2016-2024, EA31337 Ltd |
+//|                                       https://github.com/EA31337 |
+//+------------------------------------------------------------------+
+
+/*
+ *  This file is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * List of built-in strategies (type, name, class, factory function, meta flag).
+ *
+ * The file has no include guards, since it is included once per definition of STRATEGY_ENTRY
+ * (see: strategies-registry.h), so both factories and registrations are generated from this list.
+ *
+ * To build EA with a limited set of strategies, remove unused entries below.
+ */
+
+STRATEGY_ENTRY(STRAT_AC, "AC", Stg_AC, StrategyFactory_AC, false)
+STRATEGY_ENTRY(STRAT_AD, "AD", Stg_AD, StrategyFactory_AD, false)
+STRATEGY_ENTRY(STRAT_ADX, "ADX", Stg_ADX, StrategyFactory_ADX, false)
+STRATEGY_ENTRY(STRAT_ALLIGATOR, "Alligator", Stg_Alligator, StrategyFactory_Alligator, false)
+STRATEGY_ENTRY(STRAT_AMA, "AMA", Stg_AMA, StrategyFactory_AMA, false)
+STRATEGY_ENTRY(STRAT_ARROWS, "Arrows", Stg_Arrows, StrategyFactory_Arrows, false)
+STRATEGY_ENTRY(STRAT_ASI, "ASI", Stg_ASI, StrategyFactory_ASI, false)
+STRATEGY_ENTRY(STRAT_ATR, "ATR", Stg_ATR, StrategyFactory_ATR, false)
+STRATEGY_ENTRY(STRAT_AWESOME, "Awesome", Stg_Awesome, StrategyFactory_Awesome, false)
+STRATEGY_ENTRY(STRAT_BANDS, "Bands", Stg_Bands, StrategyFactory_Bands, false)
+STRATEGY_ENTRY(STRAT_BEARS_POWER, "Bear Power", Stg_BearsPower, StrategyFactory_BearsPower, false)
+STRATEGY_ENTRY(STRAT_BULLS_POWER, "Bulls Power", Stg_BullsPower, StrategyFactory_BullsPower, false)
+STRATEGY_ENTRY(STRAT_BWMFI, "BWMFI", Stg_BWMFI, StrategyFactory_BWMFI, false)
+STRATEGY_ENTRY(STRAT_CCI, "CCI", Stg_CCI, StrategyFactory_CCI, false)
+STRATEGY_ENTRY(STRAT_CHAIKIN, "Chaikin", Stg_Chaikin, StrategyFactory_Chaikin, false)
+STRATEGY_ENTRY(STRAT_DEMA, "DEMA", Stg_DEMA, StrategyFactory_DEMA, false)
+STRATEGY_ENTRY(STRAT_DEMARKER, "DeMarker", Stg_DeMarker, StrategyFactory_DeMarker, false)
+STRATEGY_ENTRY(STRAT_DPO, "DPO", Stg_DPO, StrategyFactory_DPO, false)
+STRATEGY_ENTRY(STRAT_ENVELOPES, "Envelopes", Stg_Envelopes, StrategyFactory_Envelopes, false)
+STRATEGY_ENTRY(STRAT_EWO, "ElliottWave", Stg_ElliottWave, StrategyFactory_ElliottWave, false)
+STRATEGY_ENTRY(STRAT_FORCE, "Force", Stg_Force, StrategyFactory_Force, false)
+STRATEGY_ENTRY(STRAT_FRACTALS, "Fractals", Stg_Fractals, StrategyFactory_Fractals, false)
+STRATEGY_ENTRY(STRAT_GATOR, "Gator", Stg_Gator, StrategyFactory_Gator, false)
+STRATEGY_ENTRY(STRAT_HEIKEN_ASHI, "Heiken Ashi", Stg_HeikenAshi, StrategyFactory_HeikenAshi, false)
+STRATEGY_ENTRY(STRAT_ICHIMOKU, "Ichimoku", Stg_Ichimoku, StrategyFactory_Ichimoku, false)
+STRATEGY_ENTRY(STRAT_INDICATOR, "Indicator", Stg_Indicator, StrategyFactory_Indicator, false)
+STRATEGY_ENTRY(STRAT_MA, "MA", Stg_MA, StrategyFactory_MA, false)
+STRATEGY_ENTRY(STRAT_MACD, "MACD", Stg_MACD, StrategyFactory_MACD, false)
+STRATEGY_ENTRY(STRAT_MA_BREAKOUT, "MA Breakout", Stg_MA_Breakout, StrategyFactory_MA_Breakout, false)
+STRATEGY_ENTRY(STRAT_MA_CROSS_PIVOT, "MA Cross Pivot", Stg_MA_Cross_Pivot, StrategyFactory_MA_Cross_Pivot, false)
+STRATEGY_ENTRY(STRAT_MA_CROSS_SHIFT, "MA Cross Shift", Stg_MA_Cross_Shift, StrategyFactory_MA_Cross_Shift, false)
+STRATEGY_ENTRY(STRAT_MA_CROSS_SUP_RES, "MA Cross Sup/Res", Stg_MA_Cross_Sup_Res, StrategyFactory_MA_Cross_Sup_Res,
+               false)
+STRATEGY_ENTRY(STRAT_MA_CROSS_TIMEFRAME, "MA Cross Timeframe", Stg_MA_Cross_Timeframe,
+               StrategyFactory_MA_Cross_Timeframe, false)
+STRATEGY_ENTRY(STRAT_MA_TREND, "MA Trend", Stg_MA_Trend, StrategyFactory_MA_Trend, false)
+STRATEGY_ENTRY(STRAT_MFI, "MFI", Stg_MFI, StrategyFactory_MFI, false)
+STRATEGY_ENTRY(STRAT_MOMENTUM, "Momentum", Stg_Momentum, StrategyFactory_Momentum, false)
+STRATEGY_ENTRY(STRAT_OBV, "OBV", Stg_OBV, StrategyFactory_OBV, false)
+STRATEGY_ENTRY(STRAT_OSCILLATOR, "Oscillator", Stg_Oscillator, StrategyFactory_Oscillator, false)
+STRATEGY_ENTRY(STRAT_OSCILLATOR_CROSS, "Oscillator Cross", Stg_Oscillator_Cross, StrategyFactory_Oscillator_Cross,
+               false)
+STRATEGY_ENTRY(STRAT_OSCILLATOR_CROSS_SHIFT, "Oscillator Cross Shift", Stg_Oscillator_Cross_Shift,
+               StrategyFactory_Oscillator_Cross_Shift, false)
+STRATEGY_ENTRY(STRAT_OSCILLATOR_CROSS_TIMEFRAME, "Oscillator Cross Timeframe", Stg_Oscillator_Cross_Timeframe,
+               StrategyFactory_Oscillator_Cross_Timeframe, false)
+STRATEGY_ENTRY(STRAT_OSCILLATOR_CROSS_ZERO, "Oscillator Cross Zero", Stg_Oscillator_Cross_Zero,
+               StrategyFactory_Oscillator_Cross_Zero, false)
+STRATEGY_ENTRY(STRAT_OSCILLATOR_DIVERGENCE, "Oscillator Divergence", Stg_Oscillator_Divergence,
+               StrategyFactory_Oscillator_Divergence, false)
+STRATEGY_ENTRY(STRAT_OSCILLATOR_MARTINGALE, "Oscillator Martingale", Stg_Oscillator_Martingale,
+               StrategyFactory_Oscillator_Martingale, false)
+STRATEGY_ENTRY(STRAT_OSCILLATOR_MULTI, "Oscillator Multi", Stg_Oscillator_Multi, StrategyFactory_Oscillator_Multi,
+               false)
+STRATEGY_ENTRY(STRAT_OSCILLATOR_OVERLAY, "Oscillator Overlay", Stg_Oscillator_Overlay,
+               StrategyFactory_Oscillator_Overlay, false)
+STRATEGY_ENTRY(STRAT_OSCILLATOR_RANGE, "Oscillator Range", Stg_Oscillator_Range, StrategyFactory_Oscillator_Range,
+               false)
+STRATEGY_ENTRY(STRAT_OSCILLATOR_TREND, "Oscillator Trend", Stg_Oscillator_Trend, StrategyFactory_Oscillator_Trend,
+               false)
+STRATEGY_ENTRY(STRAT_OSMA, "OSMA", Stg_OsMA, StrategyFactory_OsMA, false)
+STRATEGY_ENTRY(STRAT_PATTERN, "Pattern", Stg_Pattern, StrategyFactory_Pattern, false)
+STRATEGY_ENTRY(STRAT_PINBAR, "Pinbar", Stg_Pinbar, StrategyFactory_Pinbar, false)
+STRATEGY_ENTRY(STRAT_PIVOT, "Pivot", Stg_Pivot, StrategyFactory_Pivot, false)
+STRATEGY_ENTRY(STRAT_RETRACEMENT, "Retracement", Stg_Retracement, StrategyFactory_Retracement, false)
+STRATEGY_ENTRY(STRAT_RSI, "RSI", Stg_RSI, StrategyFactory_RSI, false)
+STRATEGY_ENTRY(STRAT_RVI, "RVI", Stg_RVI, StrategyFactory_RVI, false)
+STRATEGY_ENTRY(STRAT_SAR, "SAR", Stg_SAR, StrategyFactory_SAR, false)
+STRATEGY_ENTRY(STRAT_STDDEV, "StdDev", Stg_StdDev, StrategyFactory_StdDev, false)
+STRATEGY_ENTRY(STRAT_STOCHASTIC, "Stochastic", Stg_Stochastic, StrategyFactory_Stochastic, false)
+STRATEGY_ENTRY(STRAT_SVE_BB, "SVE Bollinger Bands", Stg_SVE_Bollinger_Bands, StrategyFactory_SVE_Bollinger_Bands, false)
+STRATEGY_ENTRY(STRAT_TMAT_SVEBB, "TMAT SVEBB", Stg_TMAT_SVEBB, StrategyFactory_TMAT_SVEBB, false)
+STRATEGY_ENTRY(STRAT_TMA_TRUE, "TMA True", Stg_TMA_True, StrategyFactory_TMA_True, false)
+STRATEGY_ENTRY(STRAT_WPR, "WPR", Stg_WPR, StrategyFactory_WPR, false)
+STRATEGY_ENTRY(STRAT_ZIGZAG, "ZigZag", Stg_ZigZag, StrategyFactory_ZigZag, false)
+#ifdef __strategies_meta__
+STRATEGY_ENTRY(STRAT_META_BEARS_BULLS, "(Meta) Bears & Bulls", Stg_Meta_Bears_Bulls, StrategyFactory_Meta_Bears_Bulls,
+               true)
+STRATEGY_ENTRY(STRAT_META_CONDITIONS, "(Meta) Conditions", Stg_Meta_Conditions, StrategyFactory_Meta_Conditions, true)
+STRATEGY_ENTRY(STRAT_META_DISCREPANCY, "(Meta) Discrepancy", Stg_Meta_Discrepancy, StrategyFactory_Meta_Discrepancy,
+               true)
+STRATEGY_ENTRY(STRAT_META_DOUBLE, "(Meta) Double", Stg_Meta_Double, StrategyFactory_Meta_Double, true)
+STRATEGY_ENTRY(STRAT_META_ENHANCE, "(Meta) Enhance", Stg_Meta_Enhance, StrategyFactory_Meta_Enhance, true)
+STRATEGY_ENTRY(STRAT_META_EQUITY, "(Meta) Equity", Stg_Meta_Equity, StrategyFactory_Meta_Equity, true)
+STRATEGY_ENTRY(STRAT_META_FORMATION, "(Meta) Formation", Stg_Meta_Formation, StrategyFactory_Meta_Formation, true)
+STRATEGY_ENTRY(STRAT_META_HEDGE, "(Meta) Hedge", Stg_Meta_Hedge, StrategyFactory_Meta_Hedge, true)
+STRATEGY_ENTRY(STRAT_META_INTERVAL, "(Meta) Interval", Stg_Meta_Interval, StrategyFactory_Meta_Interval, true)
+STRATEGY_ENTRY(STRAT_META_LIMIT, "(Meta) Limit", Stg_Meta_Limit, StrategyFactory_Meta_Limit, true)
+STRATEGY_ENTRY(STRAT_META_MARGIN, "(Meta) Margin", Stg_Meta_Margin, StrategyFactory_Meta_Margin, true)
+STRATEGY_ENTRY(STRAT_META_MARTINGALE, "(Meta) Martingale", Stg_Meta_Martingale, StrategyFactory_Meta_Martingale, true)
+STRATEGY_ENTRY(STRAT_META_MA_CROSS, "(Meta) MA Cross", Stg_Meta_MA_Cross, StrategyFactory_Meta_MA_Cross, true)
+STRATEGY_ENTRY(STRAT_META_MIRROR, "(Meta) Mirror", Stg_Meta_Mirror, StrategyFactory_Meta_Mirror, true)
+STRATEGY_ENTRY(STRAT_META_MULTI, "(Meta) Multi", Stg_Meta_Multi, StrategyFactory_Meta_Multi, true)
+STRATEGY_ENTRY(STRAT_META_MULTI_CURRENCY, "(Meta) Multi Currency", Stg_Meta_Multi_Currency,
+               StrategyFactory_Meta_Multi_Currency, true)
+#ifdef __MQL5__
+STRATEGY_ENTRY(STRAT_META_NEWS, "(Meta) News", Stg_Meta_News, StrategyFactory_Meta_News, true)
+#endif
+STRATEGY_ENTRY(STRAT_META_ORDER_LIMIT, "(Meta) Order Limit", Stg_Meta_Order_Limit, StrategyFactory_Meta_Order_Limit,
+               true)
+STRATEGY_ENTRY(STRAT_META_OSCILLATOR_FILTER, "(Meta) Oscillator Filter", Stg_Meta_Oscillator_Filter,
+               StrategyFactory_Meta_Oscillator_Filter, true)
+STRATEGY_ENTRY(STRAT_META_OSCILLATOR_SWITCH, "(Meta) Oscillator Switch", Stg_Meta_Oscillator_Switch,
+               StrategyFactory_Meta_Oscillator_Switch, true)
+STRATEGY_ENTRY(STRAT_META_PATTERN, "(Meta) Pattern", Stg_Meta_Pattern, StrategyFactory_Meta_Pattern, true)
+STRATEGY_ENTRY(STRAT_META_PIVOT, "(Meta) Pivot", Stg_Meta_Pivot, StrategyFactory_Meta_Pivot, true)
+STRATEGY_ENTRY(STRAT_META_PROFIT, "(Meta) Profit", Stg_Meta_Profit, StrategyFactory_Meta_Profit, true)
+STRATEGY_ENTRY(STRAT_META_RESISTANCE, "(Meta) Resistance", Stg_Meta_Resistance, StrategyFactory_Meta_Resistance, true)
+STRATEGY_ENTRY(STRAT_META_REVERSAL, "(Meta) Reversal", Stg_Meta_Reversal, StrategyFactory_Meta_Reversal, true)
+STRATEGY_ENTRY(STRAT_META_RISK, "(Meta) Risk", Stg_Meta_Risk, StrategyFactory_Meta_Risk, true)
+STRATEGY_ENTRY(STRAT_META_RSI, "(Meta) RSI", Stg_Meta_RSI, StrategyFactory_Meta_RSI, true)
+STRATEGY_ENTRY(STRAT_META_SAR, "(Meta) SAR", Stg_Meta_SAR, StrategyFactory_Meta_SAR, true)
+STRATEGY_ENTRY(STRAT_META_SCALPER, "(Meta) Scalper", Stg_Meta_Scalper, StrategyFactory_Meta_Scalper, true)
+STRATEGY_ENTRY(STRAT_META_SIGNAL_FILTER, "(Meta) Signal Filter", Stg_Meta_Signal_Filter,
+               StrategyFactory_Meta_Signal_Filter, true)
+STRATEGY_ENTRY(STRAT_META_SIGNAL_SWITCH, "(Meta) Signal Switch", Stg_Meta_Signal_Switch,
+               StrategyFactory_Meta_Signal_Switch, true)
+STRATEGY_ENTRY(STRAT_META_SPREAD, "(Meta) Spread", Stg_Meta_Spread, StrategyFactory_Meta_Spread, true)
+STRATEGY_ENTRY(STRAT_META_TIMEZONE, "(Meta) Timezone", Stg_Meta_Timezone, StrategyFactory_Meta_Timezone, true)
+STRATEGY_ENTRY(STRAT_META_TREND, "(Meta) Trend", Stg_Meta_Trend, StrategyFactory_Meta_Trend, true)
+STRATEGY_ENTRY(STRAT_META_TRIO, "(Meta) Trio", Stg_Meta_Trio, StrategyFactory_Meta_Trio, true)
+STRATEGY_ENTRY(STRAT_META_VOLATILITY, "(Meta) Volatility", Stg_Meta_Volatility, StrategyFactory_Meta_Volatility, true)
+STRATEGY_ENTRY(STRAT_META_WEEKDAY, "(Meta) Weekday", Stg_Meta_Weekday, StrategyFactory_Meta_Weekday, true)
+#endif  // __strategies_meta__
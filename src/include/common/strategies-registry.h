@@ -0,0 +1,131 @@
+//+------------------------------------------------------------------+
+//|                  EA31337 - multi-strategy advanced trading robot |
+//|                                 Copyright 2016-2024, EA31337 Ltd |
+//|                                       https://github.com/EA31337 |
+//+------------------------------------------------------------------+
+
+/*
+ *  This file is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Table of built-in strategies shared by strategy managers.
+ *
+ * Factories and registrations are generated from the single list (see: strategies-list.h).
+ */
+
+// Prevents processing this includes file multiple times.
+#ifndef STRATEGIES_REGISTRY_H
+#define STRATEGIES_REGISTRY_H
+
+// Strategy factory function type.
+typedef Strategy* (*StrategyFactory)(ENUM_TIMEFRAMES);
+
+// Defines factory functions of listed strategies.
+#define STRATEGY_ENTRY(SID, NAME, SCLASS, FACTORY, IS_META) \
+  Strategy* FACTORY(ENUM_TIMEFRAMES _tf) { return ((SCLASS*)NULL).Init(_tf); }
+#include "strategies-list.h"
+#undef STRATEGY_ENTRY
+
+/**
+ * Registry of strategy factories indexed by strategy type.
+ */
+class StrategiesRegistry {
+  // Registered entries indexed by strategy type.
+  static StrategyFactory _factories[];
+  static string _names[];
+  static bool _meta_flags[];
+
+  /**
+   * Registers built-in strategies.
+   */
+  static void Init() {
+#define STRATEGY_ENTRY(SID, NAME, SCLASS, FACTORY, IS_META) Register(SID, NAME, FACTORY, IS_META);
+#include "strategies-list.h"
+#undef STRATEGY_ENTRY
+  }
+
+ public:
+  /**
+   * Registers strategy factory.
+   *
+   * @param
+   *   _sid - Strategy type
+   *   _name - Strategy name
+   *   _factory - Function creating the strategy for the given timeframe
+   *   _is_meta - Whether the strategy is a meta strategy
+   */
+  static void Register(ENUM_STRATEGY _sid, string _name, StrategyFactory _factory, bool _is_meta = false) {
+    int _size = ArraySize(_factories);
+    if ((int)_sid >= _size) {
+      ArrayResize(_factories, (int)_sid + 1, 20);
+      ArrayResize(_names, (int)_sid + 1, 20);
+      ArrayResize(_meta_flags, (int)_sid + 1, 20);
+      for (int _i = _size; _i < (int)_sid; _i++) {
+        _factories[_i] = NULL;
+        _names[_i] = "";
+        _meta_flags[_i] = false;
+      }
+    }
+    _factories[_sid] = _factory;
+    _names[_sid] = _name;
+    _meta_flags[_sid] = _is_meta;
+  }
+
+  /**
+   * Checks whether strategy of the given type is registered.
+   */
+  static bool IsRegistered(ENUM_STRATEGY _sid) {
+    if (ArraySize(_factories) == 0) {
+      Init();
+    }
+    return _sid > STRAT_NONE && (int)_sid < ArraySize(_factories) && _factories[_sid] != NULL;
+  }
+
+  /**
+   * Checks whether strategy of the given type is a meta strategy.
+   */
+  static bool IsMeta(ENUM_STRATEGY _sid) { return IsRegistered(_sid) && _meta_flags[_sid]; }
+
+  /**
+   * Gets name of the registered strategy.
+   */
+  static string GetName(ENUM_STRATEGY _sid) { return IsRegistered(_sid) ? _names[_sid] : ""; }
+
+  /**
+   * Creates strategy by enum type.
+   *
+   * @param
+   *   _sid - Strategy type
+   *   _tf - Timeframe to initialize
+   *   _is_meta - Whether to create meta (true) or regular (false) strategies only
+   *
+   * @return
+   *   Returns strategy pointer on successful initialization, otherwise NULL.
+   */
+  static Strategy* Create(ENUM_STRATEGY _sid, ENUM_TIMEFRAMES _tf, bool _is_meta) {
+    if (!IsRegistered(_sid) || _meta_flags[_sid] != _is_meta) {
+      return NULL;
+    }
+    StrategyFactory _factory = _factories[_sid];
+    return _factory(_tf);
+  }
+};
+
+StrategyFactory StrategiesRegistry::_factories[];
+string StrategiesRegistry::_names[];
+bool StrategiesRegistry::_meta_flags[];
+
+#endif  // STRATEGIES_REGISTRY_H
@@ -34,3 +34,25 @@ struct EADetails {
     return SerializerNodeObject;
   }
 };
+
+// Strategy to be initialized on the first new bar of its timeframe.
+struct EAStrategyPending {
+  ENUM_STRATEGY sid;   // Strategy type.
+  ENUM_TIMEFRAMES tf;  // Strategy timeframe.
+  datetime bar_time;   // Bar time at the moment of adding.
+};
+
+// EA's configuration resolved from inputs (and optionally overridden by a parameter sweep).
+struct EAConfig {
+  ENUM_STRATEGY strats[FINAL_ENUM_TIMEFRAMES_INDEX];  // Strategy type per timeframe.
+  int strats_filter;                                  // Filter of active timeframes.
+  int signal_open_filter;                             // Signal open filter method.
+  int signal_close_filter;                            // Signal close filter method.
+  int signal_open_time;                               // Signal open filter time.
+  int tick_filter;                                    // Tick filter method.
+  float order_close_loss;                             // Close loss (in pips).
+  float order_close_profit;                           // Close profit (in pips).
+  int order_close_time;                               // Close time.
+  double lot_size;                                    // Lot size (0 = auto).
+  float max_spread;                                   // Max spread to trade (in pips).
+};
@@ -0,0 +1,132 @@
+//+------------------------------------------------------------------+
+//|                  EA31337 - multi-strategy advanced trading robot |
+//|                                 Copyright 2016-2024, EA31337 Ltd |
+//|                                       https://github.com/EA31337 |
+//+------------------------------------------------------------------+
+
+/*
+ *  This file is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Parameter sweep driven by rows of a file (enabled by __sweep__).
+ */
+
+// Prevents processing this includes file multiple times.
+#ifndef EA_SWEEP_H
+#define EA_SWEEP_H
+
+/**
+ * Reads a row of parameters from the sweep file.
+ *
+ * The file is a CSV file with input names in the header, e.g.:
+ *   Strategy_M30,Strategy_H1,EA_SignalOpenFilterMethod,EA_OrderCloseLoss
+ *   26,0,72,280
+ *   26,31,36,200
+ * where values are numeric (as in .set files). Missing columns keep values of inputs.
+ *
+ * Optimizing the row index in the Strategy Tester lets its agents run the whole sweep in parallel.
+ */
+class EASweep {
+ protected:
+  string file_name;
+  int file_flags;
+  string names[];
+  string values[];
+
+ public:
+  /**
+   * Class constructor.
+   *
+   * @param
+   *   _file_name - name of the sweep file
+   *   _flags - extra file flags (FILE_COMMON to use the common data folder)
+   */
+  EASweep(string _file_name, int _flags = FILE_COMMON) : file_name(_file_name), file_flags(_flags) {}
+
+  /**
+   * Loads the row with the given index (starting from 0, excluding the header).
+   *
+   * @return
+   *   Returns true when the row has been found, otherwise false.
+   */
+  bool Load(int _index) {
+    int _handle = FileOpen(file_name, FILE_READ | FILE_CSV | FILE_ANSI | FILE_SHARE_READ | file_flags, ',');
+    if (_handle == INVALID_HANDLE) {
+      return false;
+    }
+    ArrayResize(names, 0, 32);
+    ArrayResize(values, 0, 32);
+    int _row = -1;
+    while (!FileIsEnding(_handle) && _row <= _index) {
+      int _col = 0;
+      do {
+        string _value = FileReadString(_handle);
+        StringTrimLeft(_value);
+        StringTrimRight(_value);
+        if (_row < 0) {
+          ArrayResize(names, _col + 1, 32);
+          names[_col] = _value;
+        } else if (_row == _index && _col < ArraySize(names)) {
+          ArrayResize(values, _col + 1, 32);
+          values[_col] = _value;
+        }
+        _col++;
+      } while (!FileIsLineEnding(_handle) && !FileIsEnding(_handle));
+      _row++;
+    }
+    FileClose(_handle);
+    return _row > _index && ArraySize(values) > 0;
+  }
+
+  /* Getters */
+
+  /**
+   * Gets value of the parameter.
+   *
+   * @return
+   *   Returns value from the loaded row, otherwise the default one.
+   */
+  double Get(string _name, double _default) {
+    for (int _i = 0; _i < ArraySize(values); _i++) {
+      if (names[_i] == _name && values[_i] != "") {
+        return StringToDouble(values[_i]);
+      }
+    }
+    return _default;
+  }
+
+  /**
+   * Applies the loaded row to the EA's configuration.
+   */
+  void Apply(EAConfig &_config) {
+    string _tfs[] = {"M1", "M5", "M15", "M30", "H1", "H2", "H3", "H4", "H6", "H8", "H12"};
+    for (int _i = 0; _i < ArraySize(_tfs); _i++) {
+      _config.strats[_i] = (ENUM_STRATEGY)Get("Strategy_" + _tfs[_i], _config.strats[_i]);
+    }
+    _config.strats_filter = (int)Get("EA_Strategy_Filter", _config.strats_filter);
+    _config.signal_open_filter = (int)Get("EA_SignalOpenFilterMethod", _config.signal_open_filter);
+    _config.signal_close_filter = (int)Get("EA_SignalCloseFilterMethod", _config.signal_close_filter);
+    _config.signal_open_time = (int)Get("EA_SignalOpenFilterTime", _config.signal_open_time);
+    _config.tick_filter = (int)Get("EA_TickFilterMethod", _config.tick_filter);
+    _config.order_close_loss = (float)Get("EA_OrderCloseLoss", _config.order_close_loss);
+    _config.order_close_profit = (float)Get("EA_OrderCloseProfit", _config.order_close_profit);
+    _config.order_close_time = (int)Get("EA_OrderCloseTime", _config.order_close_time);
+    _config.lot_size = Get("EA_LotSize", _config.lot_size);
+    _config.max_spread = (float)Get("EA_MaxSpread", _config.max_spread);
+  }
+};
+
+#endif  // EA_SWEEP_H
@@ -0,0 +1,321 @@
+//+------------------------------------------------------------------+
+//|                  EA31337 - multi-strategy advanced trading robot |
+//|                                 Copyright 2016-2024, EA31337 Ltd |
+//|                                       https://github.com/EA31337 |
+//+------------------------------------------------------------------+
+
+/*
+ *  This file is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Typed evaluators for EA's tasks, checked only on relevant events.
+ */
+
+// Prevents processing this includes file multiple times.
+#ifndef EA_TASKS_COMPILED_H
+#define EA_TASKS_COMPILED_H
+
+// Kinds of compiled task conditions.
+enum ENUM_EA_TASK_COMPILED_COND {
+  EA_TASK_COMPILED_COND_NONE = 0,    // Not supported.
+  EA_TASK_COMPILED_COND_NEW_PERIOD,  // New day or month.
+  EA_TASK_COMPILED_COND_PROFIT,      // Orders' profit relative to the balance.
+};
+
+/**
+ * Task compiled from the condition and action pair.
+ */
+struct EATaskCompiled {
+  ENUM_EA_TASK_COMPILED_COND kind;  // Kind of the condition.
+  ENUM_TRADE_CONDITION cond;        // Trade condition (for profit conditions).
+  ENUM_TRADE_ACTION action;         // Trade action to execute.
+  int rank;                         // Rank of the position to close by profit (-1 to use the trade action).
+  ENUM_TIMEFRAMES period;           // Period to check for (for new period conditions).
+  long period_no;                   // Number of the last period.
+  ulong orders_version;             // Version of orders used for the cached result.
+  double bid;                       // Bid price used for the cached result.
+  double ask;                       // Ask price used for the cached result.
+  bool result;                      // Cached result of the condition.
+
+  // Struct constructor.
+  EATaskCompiled()
+      : kind(EA_TASK_COMPILED_COND_NONE),
+        rank(-1),
+        period(PERIOD_D1),
+        period_no(-1),
+        orders_version(0),
+        bid(0),
+        ask(0),
+        result(false) {}
+
+  /**
+   * Gets number of the current period, so change of it means a new period.
+   */
+  long GetPeriodNo(datetime _time) {
+    long _day = (long)_time / 86400;
+    switch (period) {
+      case PERIOD_MN1: {
+        MqlDateTime _dt;
+        TimeToStruct(_time, _dt);
+        return _dt.year * 12 + _dt.mon;
+      }
+    }
+    return _day;
+  }
+
+  /**
+   * Checks the condition.
+   *
+   * @param
+   *   _trade - trade instance to check the condition for
+   *   _day - number of the current day
+   *   _orders_version - version of orders, which changes on each opened or closed order
+   *   _bid - current bid price of the symbol
+   *   _ask - current ask price of the symbol
+   */
+  bool Check(Trade *_trade, long _day, ulong _orders_version, double _bid, double _ask) {
+    switch (kind) {
+      case EA_TASK_COMPILED_COND_NEW_PERIOD: {
+        long _period_no = period == PERIOD_D1 ? _day : GetPeriodNo(TimeCurrent());
+        result = _period_no != period_no;
+        period_no = _period_no;
+        return result;
+      }
+      case EA_TASK_COMPILED_COND_PROFIT: {
+        if (_orders_version != orders_version || _bid != bid || _ask != ask) {
+          // Orders' profit can only change along with orders or their prices.
+          result = _trade.CheckCondition(cond);
+          orders_version = _orders_version;
+          bid = _bid;
+          ask = _ask;
+        }
+        return result;
+      }
+    }
+    return false;
+  }
+};
+
+/**
+ * Keeps compiled tasks and evaluates them.
+ *
+ * Conditions which cannot be compiled are expected to be added as generic tasks.
+ */
+class EATasksCompiled {
+ protected:
+  EATaskCompiled tasks[];
+  string symbol;  // Symbol of orders.
+  long day;       // Number of the last processed day.
+#ifdef __MQL5__
+  EAOrdersCache *orders;  // Cache of open positions used to close them by their profit.
+#endif
+
+ public:
+  /**
+   * Class constructor.
+   */
+  EATasksCompiled(string _symbol = NULL) : symbol(_symbol == NULL ? _Symbol : _symbol), day(-1) {
+#ifdef __MQL5__
+    orders = NULL;
+#endif
+  }
+
+  /* Setters */
+
+#ifdef __MQL5__
+  /**
+   * Sets cache of open positions used to close them by their profit.
+   */
+  void SetOrdersCache(EAOrdersCache *_orders) { orders = _orders; }
+#endif
+
+  /**
+   * Sets symbol of orders.
+   */
+  void SetSymbol(string _symbol) { symbol = _symbol; }
+
+  /**
+   * Compiles and adds a new task.
+   *
+   * @return
+   *   Returns true when the task has been compiled, otherwise false.
+   */
+  bool Add(ENUM_EA_ADV_COND _cond, ENUM_EA_ADV_ACTION _action) {
+    EATaskCompiled _task;
+#ifdef __MQL5__
+    if (orders != NULL) {
+      switch (_action) {
+        case EA_ADV_ACTION_CLOSE_LEAST_LOSS:
+          _task.rank = EA_ORDERS_CACHE_RANK_LEAST_LOSS;
+          break;
+        case EA_ADV_ACTION_CLOSE_LEAST_PROFIT:
+          _task.rank = EA_ORDERS_CACHE_RANK_LEAST_PROFIT;
+          break;
+        case EA_ADV_ACTION_CLOSE_MOST_LOSS:
+          _task.rank = EA_ORDERS_CACHE_RANK_MOST_LOSS;
+          break;
+        case EA_ADV_ACTION_CLOSE_MOST_PROFIT:
+          _task.rank = EA_ORDERS_CACHE_RANK_MOST_PROFIT;
+          break;
+      }
+    }
+#endif
+    switch (_action) {
+      case EA_ADV_ACTION_CLOSE_MOST_LOSS:
+        _task.action = TRADE_ACTION_ORDER_CLOSE_MOST_LOSS;
+        break;
+      case EA_ADV_ACTION_CLOSE_MOST_PROFIT:
+        _task.action = TRADE_ACTION_ORDER_CLOSE_MOST_PROFIT;
+        break;
+      case EA_ADV_ACTION_ORDERS_CLOSE_ALL:
+        _task.action = TRADE_ACTION_ORDERS_CLOSE_ALL;
+        break;
+      case EA_ADV_ACTION_ORDERS_CLOSE_IN_PROFIT:
+        _task.action = TRADE_ACTION_ORDERS_CLOSE_IN_PROFIT;
+        break;
+      case EA_ADV_ACTION_ORDERS_CLOSE_IN_TREND:
+        _task.action = TRADE_ACTION_ORDERS_CLOSE_IN_TREND;
+        break;
+      case EA_ADV_ACTION_ORDERS_CLOSE_IN_TREND_NOT:
+        _task.action = TRADE_ACTION_ORDERS_CLOSE_IN_TREND_NOT;
+        break;
+      case EA_ADV_ACTION_ORDERS_CLOSE_SIDE_IN_LOSS:
+        _task.action = TRADE_ACTION_ORDERS_CLOSE_SIDE_IN_LOSS;
+        break;
+      case EA_ADV_ACTION_ORDERS_CLOSE_SIDE_IN_PROFIT:
+        _task.action = TRADE_ACTION_ORDERS_CLOSE_SIDE_IN_PROFIT;
+        break;
+      default:
+        if (_task.rank < 0) {
+          return false;
+        }
+        break;
+    }
+    switch (_cond) {
+      case EA_ADV_COND_EA_ON_NEW_DAY:
+        _task.kind = EA_TASK_COMPILED_COND_NEW_PERIOD;
+        _task.period = PERIOD_D1;
+        break;
+      case EA_ADV_COND_EA_ON_NEW_MONTH:
+        _task.kind = EA_TASK_COMPILED_COND_NEW_PERIOD;
+        _task.period = PERIOD_MN1;
+        break;
+      case EA_ADV_COND_TRADE_EQUITY_GT_01PC:
+        _task.kind = EA_TASK_COMPILED_COND_PROFIT;
+        _task.cond = TRADE_COND_ORDERS_PROFIT_GT_01PC;
+        break;
+      case EA_ADV_COND_TRADE_EQUITY_LT_01PC:
+        _task.kind = EA_TASK_COMPILED_COND_PROFIT;
+        _task.cond = TRADE_COND_ORDERS_PROFIT_LT_01PC;
+        break;
+      case EA_ADV_COND_TRADE_EQUITY_GT_02PC:
+        _task.kind = EA_TASK_COMPILED_COND_PROFIT;
+        _task.cond = TRADE_COND_ORDERS_PROFIT_GT_02PC;
+        break;
+      case EA_ADV_COND_TRADE_EQUITY_LT_02PC:
+        _task.kind = EA_TASK_COMPILED_COND_PROFIT;
+        _task.cond = TRADE_COND_ORDERS_PROFIT_LT_02PC;
+        break;
+      case EA_ADV_COND_TRADE_EQUITY_GT_05PC:
+        _task.kind = EA_TASK_COMPILED_COND_PROFIT;
+        _task.cond = TRADE_COND_ORDERS_PROFIT_GT_05PC;
+        break;
+      case EA_ADV_COND_TRADE_EQUITY_LT_05PC:
+        _task.kind = EA_TASK_COMPILED_COND_PROFIT;
+        _task.cond = TRADE_COND_ORDERS_PROFIT_LT_05PC;
+        break;
+      case EA_ADV_COND_TRADE_EQUITY_GT_10PC:
+        _task.kind = EA_TASK_COMPILED_COND_PROFIT;
+        _task.cond = TRADE_COND_ORDERS_PROFIT_GT_10PC;
+        break;
+      case EA_ADV_COND_TRADE_EQUITY_LT_10PC:
+        _task.kind = EA_TASK_COMPILED_COND_PROFIT;
+        _task.cond = TRADE_COND_ORDERS_PROFIT_LT_10PC;
+        break;
+      default:
+        return false;
+    }
+    if (_task.kind == EA_TASK_COMPILED_COND_NEW_PERIOD) {
+      // Starts from the current period, so its first change after start is detected.
+      _task.period_no = _task.GetPeriodNo(TimeCurrent());
+    }
+    int _size = ArraySize(tasks);
+    ArrayResize(tasks, _size + 1, 5);
+    tasks[_size] = _task;
+    return true;
+  }
+
+  /**
+   * Evaluates tasks and executes actions of the passed ones.
+   *
+   * @return
+   *   Returns number of executed actions.
+   */
+  int Process(Trade *_trade) {
+    int _count = 0;
+    if (ArraySize(tasks) == 0) {
+      return _count;
+    }
+    long _day = (long)TimeCurrent() / 86400;
+    bool _new_day = _day != day;
+    day = _day;
+    ulong _orders_version = GetOrdersVersion();
+    double _bid = SymbolInfoDouble(symbol, SYMBOL_BID);
+    double _ask = SymbolInfoDouble(symbol, SYMBOL_ASK);
+    for (int _i = 0; _i < ArraySize(tasks); _i++) {
+      if (tasks[_i].kind == EA_TASK_COMPILED_COND_NEW_PERIOD && !_new_day) {
+        // New periods can start only on a new day.
+        continue;
+      }
+      if (!tasks[_i].Check(_trade, _day, _orders_version, _bid, _ask)) {
+        continue;
+      }
+#ifdef __MQL5__
+      if (tasks[_i].rank >= 0) {
+        ulong _ticket = orders.GetByProfit((ENUM_EA_ORDERS_CACHE_RANK)tasks[_i].rank);
+        _count += _ticket > 0 && orders.ClosePosition(_ticket) ? 1 : 0;
+        continue;
+      }
+#endif
+      _trade.ExecuteAction(tasks[_i].action);
+      _count++;
+    }
+    return _count;
+  }
+
+  /* Getters */
+
+  /**
+   * Gets version of orders, which changes on each opened or closed order.
+   */
+  ulong GetOrdersVersion() {
+#ifdef __MQL5__
+    if (orders != NULL) {
+      return orders.GetVersion();
+    }
+    return ((ulong)PositionsTotal() << 32) | (ulong)OrdersTotal();
+#else
+    return ((ulong)OrdersHistoryTotal() << 32) | (ulong)OrdersTotal();
+#endif
+  }
+
+  /**
+   * Gets number of compiled tasks.
+   */
+  int GetSize() { return ArraySize(tasks); }
+};
+
+#endif  // EA_TASKS_COMPILED_H
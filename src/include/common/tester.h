@@ -0,0 +1,479 @@
+//+------------------------------------------------------------------+
+//|                  EA31337 - multi-strategy advanced trading robot |
+//|                                 Copyright 2016-2024, EA31337 Ltd |
+//|                                       https://github.com/EA31337 |
+//+------------------------------------------------------------------+
+
+/*
+ *  This file is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Strategy Tester's helpers (MQL5 only).
+ */
+
+// Prevents processing this includes file multiple times.
+#ifndef EA_TESTER_H
+#define EA_TESTER_H
+
+// Defines.
+#define EA_TESTER_PENALTY -1.0e9  // Criterion of passes which are not acceptable.
+#define EA_TESTER_PF_MAX 10.0     // Cap of profit factor (e.g. when there are no losses).
+#define EA_TESTER_FRAME_HEADER 10  // Number of pass' values in the frame (before values per magic number).
+
+// Custom criteria of optimization passes.
+enum ENUM_EA_TESTER_CRITERION {
+  EA_TESTER_CRITERION_NONE = 0,         // (None)
+  EA_TESTER_CRITERION_PROFIT,           // Net profit
+  EA_TESTER_CRITERION_PROFIT_FACTOR,    // Profit factor
+  EA_TESTER_CRITERION_RECOVERY_FACTOR,  // Recovery factor
+  EA_TESTER_CRITERION_SHARPE_RATIO,     // Sharpe ratio
+  EA_TESTER_CRITERION_EXPECTED_PAYOFF,  // Expected payoff
+  EA_TESTER_CRITERION_PROFIT_DD,        // Profit x profit factor / drawdown
+};
+
+/**
+ * Calculates results of the tester's pass.
+ *
+ * Custom criterion is returned by OnTester(), so the tester's genetic algorithm
+ * (which skips genomes already evaluated) searches the input space by it.
+ */
+class EATester {
+ public:
+  /**
+   * Gets value of the custom criterion for the current pass.
+   *
+   * @param
+   *   _criterion - criterion to calculate
+   *   _min_trades - minimum number of trades for the pass to be acceptable
+   *   _is_aborted - whether the pass has been aborted early
+   *
+   * @return
+   *   Returns value to maximize, or EA_TESTER_PENALTY for not acceptable passes.
+   */
+  static double GetCriterion(ENUM_EA_TESTER_CRITERION _criterion, int _min_trades = 0, bool _is_aborted = false) {
+    if (_criterion == EA_TESTER_CRITERION_NONE) {
+      return 0;
+    }
+    if (_is_aborted || TesterStatistics(STAT_TRADES) < _min_trades) {
+      return EA_TESTER_PENALTY;
+    }
+    double _profit = TesterStatistics(STAT_PROFIT);
+    double _pf = GetProfitFactor();
+    switch (_criterion) {
+      case EA_TESTER_CRITERION_PROFIT:
+        return _profit;
+      case EA_TESTER_CRITERION_PROFIT_FACTOR:
+        return _pf;
+      case EA_TESTER_CRITERION_RECOVERY_FACTOR:
+        return TesterStatistics(STAT_RECOVERY_FACTOR);
+      case EA_TESTER_CRITERION_SHARPE_RATIO:
+        return TesterStatistics(STAT_SHARPE_RATIO);
+      case EA_TESTER_CRITERION_EXPECTED_PAYOFF:
+        return TesterStatistics(STAT_EXPECTED_PAYOFF);
+      case EA_TESTER_CRITERION_PROFIT_DD:
+        // Losing passes are ranked by profit only.
+        return _profit > 0 ? _profit * _pf / (1 + TesterStatistics(STAT_EQUITY_DDREL_PERCENT)) : _profit;
+      default:
+        break;
+    }
+    return 0;
+  }
+
+  /**
+   * Gets profit factor of the current pass.
+   *
+   * @return
+   *   Returns profit factor capped by EA_TESTER_PF_MAX.
+   */
+  static double GetProfitFactor() {
+    return GetProfitFactor(TesterStatistics(STAT_GROSS_PROFIT), -TesterStatistics(STAT_GROSS_LOSS));
+  }
+
+  /**
+   * Gets profit factor of the given gross profit and loss.
+   *
+   * @return
+   *   Returns profit factor capped by EA_TESTER_PF_MAX.
+   */
+  static double GetProfitFactor(double _profit, double _loss) {
+    if (_loss <= 0) {
+      return _profit > 0 ? EA_TESTER_PF_MAX : 0;
+    }
+    return fmin(_profit / _loss, EA_TESTER_PF_MAX);
+  }
+};
+
+/**
+ * Aborts the tester's pass once it breaks the acceptable limits.
+ *
+ * Limits are checked incrementally (equity per tick, losses per closing deal),
+ * so hopeless passes of wide optimizations are stopped early.
+ */
+class EATesterAbort {
+ protected:
+  double dd_max;      // Max drawdown of equity (in %).
+  double equity_min;  // Min equity.
+  int losses_max;     // Max consecutive losses.
+  double equity_peak;
+  int losses;
+  string reason;
+
+ public:
+  /**
+   * Class constructor.
+   */
+  EATesterAbort() : dd_max(0), equity_min(0), losses_max(0), equity_peak(0), losses(0) {}
+
+  /**
+   * Sets limits (0 disables the limit).
+   *
+   * Limits are applied in the Strategy Tester only.
+   */
+  void SetLimits(double _dd_max, double _equity_min, int _losses_max) {
+    bool _is_tester = MQLInfoInteger(MQL_TESTER) != 0;
+    dd_max = _is_tester ? _dd_max : 0;
+    equity_min = _is_tester ? _equity_min : 0;
+    losses_max = _is_tester ? _losses_max : 0;
+  }
+
+  /**
+   * Checks limits of equity on tick.
+   *
+   * @return
+   *   Returns true when the pass has been aborted.
+   */
+  bool Check() {
+    if (reason != "" || (dd_max <= 0 && equity_min <= 0)) {
+      return reason != "";
+    }
+    double _equity = AccountInfoDouble(ACCOUNT_EQUITY);
+    equity_peak = _equity > equity_peak ? _equity : equity_peak;
+    if (dd_max > 0 && equity_peak > 0 && (equity_peak - _equity) / equity_peak * 100 >= dd_max) {
+      return Abort(StringFormat("Drawdown of equity reached %.2f%%", dd_max));
+    }
+    if (equity_min > 0 && _equity <= equity_min) {
+      return Abort(StringFormat("Equity fell below %.2f", equity_min));
+    }
+    return false;
+  }
+
+  /**
+   * Counts consecutive losses on trade transaction.
+   */
+  void OnTradeTransaction(const MqlTradeTransaction &_trans) {
+    if (losses_max <= 0 || reason != "" || _trans.type != TRADE_TRANSACTION_DEAL_ADD ||
+        !HistoryDealSelect(_trans.deal) || HistoryDealGetInteger(_trans.deal, DEAL_ENTRY) == DEAL_ENTRY_IN) {
+      return;
+    }
+    double _profit = HistoryDealGetDouble(_trans.deal, DEAL_PROFIT) + HistoryDealGetDouble(_trans.deal, DEAL_SWAP) +
+                     HistoryDealGetDouble(_trans.deal, DEAL_COMMISSION);
+    losses = _profit < 0 ? losses + 1 : 0;
+    if (losses >= losses_max) {
+      Abort(StringFormat("Reached %d consecutive losses", losses));
+    }
+  }
+
+  /**
+   * Stops the pass with the given reason.
+   */
+  bool Abort(string _reason) {
+    reason = _reason;
+    PrintFormat("Pass aborted: %s.", reason);
+    TesterStop();
+    return true;
+  }
+
+  /* Getters */
+
+  /**
+   * Gets reason of the abort (empty when not aborted).
+   */
+  string GetReason() { return reason; }
+
+  /**
+   * Checks whether the pass has been aborted.
+   */
+  bool IsAborted() { return reason != ""; }
+};
+
+/**
+ * Metrics of the tester's pass calculated incrementally per closing deal.
+ *
+ * Profits are attributed per magic number (i.e. per strategy and timeframe).
+ * Metrics are sent as a frame, so results of all passes can be collected in OnTesterPass().
+ */
+class EATesterMetrics {
+ protected:
+  double gross_profit;
+  double gross_loss;
+  double balance_peak;
+  double balance_dd_max;
+  int trades;
+  int wins;
+  int losses;
+  int cons_wins;
+  int cons_wins_max;
+  int cons_losses;
+  int cons_losses_max;
+  long magics[];
+  int magic_trades[];
+  double magic_profits[];
+
+  /**
+   * Gets index of the magic number (adds a new one when not found).
+   */
+  int GetMagicIndex(long _magic) {
+    int _size = ArraySize(magics);
+    for (int _i = 0; _i < _size; _i++) {
+      if (magics[_i] == _magic) {
+        return _i;
+      }
+    }
+    ArrayResize(magics, _size + 1, 32);
+    ArrayResize(magic_trades, _size + 1, 32);
+    ArrayResize(magic_profits, _size + 1, 32);
+    magics[_size] = _magic;
+    magic_trades[_size] = 0;
+    magic_profits[_size] = 0;
+    return _size;
+  }
+
+ public:
+  /**
+   * Class constructor.
+   */
+  EATesterMetrics()
+      : gross_profit(0),
+        gross_loss(0),
+        balance_peak(0),
+        balance_dd_max(0),
+        trades(0),
+        wins(0),
+        losses(0),
+        cons_wins(0),
+        cons_wins_max(0),
+        cons_losses(0),
+        cons_losses_max(0) {}
+
+  /**
+   * Initializes metrics at the start of the pass.
+   */
+  void Init() { balance_peak = AccountInfoDouble(ACCOUNT_BALANCE); }
+
+  /**
+   * Updates metrics on trade transaction.
+   */
+  void OnTradeTransaction(const MqlTradeTransaction &_trans) {
+    if (_trans.type != TRADE_TRANSACTION_DEAL_ADD || !HistoryDealSelect(_trans.deal) ||
+        HistoryDealGetInteger(_trans.deal, DEAL_ENTRY) == DEAL_ENTRY_IN) {
+      return;
+    }
+    long _type = HistoryDealGetInteger(_trans.deal, DEAL_TYPE);
+    if (_type != DEAL_TYPE_BUY && _type != DEAL_TYPE_SELL) {
+      // Skips balance operations.
+      return;
+    }
+    double _profit = HistoryDealGetDouble(_trans.deal, DEAL_PROFIT) + HistoryDealGetDouble(_trans.deal, DEAL_SWAP) +
+                     HistoryDealGetDouble(_trans.deal, DEAL_COMMISSION);
+    int _index = GetMagicIndex(HistoryDealGetInteger(_trans.deal, DEAL_MAGIC));
+    magic_trades[_index]++;
+    magic_profits[_index] += _profit;
+    trades++;
+    if (_profit > 0) {
+      gross_profit += _profit;
+      wins++;
+      cons_wins++;
+      cons_losses = 0;
+    } else if (_profit < 0) {
+      gross_loss -= _profit;
+      losses++;
+      cons_losses++;
+      cons_wins = 0;
+    }
+    cons_wins_max = cons_wins > cons_wins_max ? cons_wins : cons_wins_max;
+    cons_losses_max = cons_losses > cons_losses_max ? cons_losses : cons_losses_max;
+    double _balance = AccountInfoDouble(ACCOUNT_BALANCE);
+    balance_peak = _balance > balance_peak ? _balance : balance_peak;
+    balance_dd_max = balance_peak - _balance > balance_dd_max ? balance_peak - _balance : balance_dd_max;
+  }
+
+  /**
+   * Packs metrics into the frame's data.
+   *
+   * Layout: EA_TESTER_FRAME_HEADER values, then triplets of magic, trades and profit.
+   */
+  void ToFrame(double &_data[], bool _is_aborted) {
+    int _size = ArraySize(magics);
+    ArrayResize(_data, EA_TESTER_FRAME_HEADER + _size * 3);
+    _data[0] = gross_profit - gross_loss;
+    _data[1] = EATester::GetProfitFactor(gross_profit, gross_loss);
+    _data[2] = trades;
+    _data[3] = wins;
+    _data[4] = losses;
+    _data[5] = cons_wins_max;
+    _data[6] = cons_losses_max;
+    _data[7] = balance_dd_max;
+    _data[8] = TesterStatistics(STAT_EQUITY_DDREL_PERCENT);
+    _data[9] = _is_aborted;
+    for (int _i = 0; _i < _size; _i++) {
+      _data[EA_TESTER_FRAME_HEADER + _i * 3] = (double)magics[_i];
+      _data[EA_TESTER_FRAME_HEADER + _i * 3 + 1] = magic_trades[_i];
+      _data[EA_TESTER_FRAME_HEADER + _i * 3 + 2] = magic_profits[_i];
+    }
+  }
+
+  /**
+   * Writes the frame as a JSON line.
+   *
+   * @param
+   *   _writer - writer to write into
+   *   _pass - number of the pass
+   *   _value - value of the custom criterion
+   *   _data - frame's data (see ToFrame())
+   *   _params - pass' inputs in "name=value" format
+   *   _magic_no - starting magic number (to resolve strategy and timeframe)
+   */
+  static void FrameToJson(EAJsonWriter &_writer, ulong _pass, double _value, double &_data[], string &_params[],
+                          long _magic_no) {
+    _writer.BeginObject();
+    _writer.AddInt("pass", (long)_pass);
+    _writer.AddDouble("criterion", _value, 4);
+    _writer.AddDouble("profit", _data[0]);
+    _writer.AddDouble("profit_factor", _data[1], 4);
+    _writer.AddInt("trades", (long)_data[2]);
+    _writer.AddInt("wins", (long)_data[3]);
+    _writer.AddInt("losses", (long)_data[4]);
+    _writer.AddInt("cons_wins_max", (long)_data[5]);
+    _writer.AddInt("cons_losses_max", (long)_data[6]);
+    _writer.AddDouble("balance_dd", _data[7]);
+    _writer.AddDouble("equity_dd_pct", _data[8]);
+    _writer.AddBool("aborted", _data[9] > 0);
+    double _tf_profits[FINAL_ENUM_TIMEFRAMES_INDEX];
+    ArrayInitialize(_tf_profits, 0);
+    _writer.BeginArray("strategies");
+    for (int _i = EA_TESTER_FRAME_HEADER; _i + 2 < ArraySize(_data); _i += 3) {
+      long _offset = (long)_data[_i] - _magic_no;
+      int _tfi = (int)(_offset % FINAL_ENUM_TIMEFRAMES_INDEX);
+      _writer.BeginObject();
+      _writer.AddInt("magic", (long)_data[_i]);
+      if (_offset >= 0) {
+        _tf_profits[_tfi] += _data[_i + 2];
+        _writer.AddInt("strategy", _offset / FINAL_ENUM_TIMEFRAMES_INDEX);
+        _writer.AddString("tf", ChartTf::IndexToString((ENUM_TIMEFRAMES_INDEX)_tfi));
+      }
+      _writer.AddInt("trades", (long)_data[_i + 1]);
+      _writer.AddDouble("profit", _data[_i + 2]);
+      _writer.EndObject();
+    }
+    _writer.EndArray();
+    _writer.BeginObject("timeframes");
+    for (int _tfi = 0; _tfi < FINAL_ENUM_TIMEFRAMES_INDEX; _tfi++) {
+      if (_tf_profits[_tfi] != 0) {
+        _writer.AddDouble(ChartTf::IndexToString((ENUM_TIMEFRAMES_INDEX)_tfi), _tf_profits[_tfi]);
+      }
+    }
+    _writer.EndObject();
+    _writer.BeginObject("params");
+    for (int _i = 0; _i < ArraySize(_params); _i++) {
+      int _sep = StringFind(_params[_i], "=");
+      _writer.AddString(_sep > 0 ? StringSubstr(_params[_i], 0, _sep) : _params[_i],
+                        _sep > 0 ? StringSubstr(_params[_i], _sep + 1) : "");
+    }
+    _writer.EndObject();
+    _writer.EndObject();
+    _writer.EndLine();
+  }
+};
+
+/**
+ * Collects results of the tester's passes into a JSON lines file.
+ */
+class EATesterResults {
+ protected:
+  int handle;
+  EAJsonWriter writer;
+
+ public:
+  /**
+   * Class constructor.
+   */
+  EATesterResults() : handle(INVALID_HANDLE) {}
+
+  /**
+   * Class destructor.
+   */
+  ~EATesterResults() { Close(); }
+
+  /**
+   * Opens the file (in the common data folder) for writing.
+   */
+  bool Open(string _file_name) {
+    Close();
+    handle = FileOpen(_file_name, FILE_WRITE | FILE_TXT | FILE_ANSI | FILE_SHARE_READ | FILE_COMMON);
+    writer.Reset();
+    writer.SetFile(handle);
+    return handle != INVALID_HANDLE;
+  }
+
+  /**
+   * Receives frames of finished passes and writes them.
+   *
+   * @return
+   *   Returns number of written passes.
+   */
+  int OnTesterPass(long _magic_no) {
+    ulong _pass;
+    string _name;
+    long _id;
+    double _value;
+    double _data[];
+    string _params[];
+    uint _params_count;
+    int _count = 0;
+    while (handle != INVALID_HANDLE && FrameNext(_pass, _name, _id, _value, _data)) {
+      FrameInputs(_pass, _params, _params_count);
+      EATesterMetrics::FrameToJson(writer, _pass, _value, _data, _params, _magic_no);
+      _count++;
+    }
+    return _count;
+  }
+
+  /**
+   * Writes results of the single pass (without optimization).
+   */
+  bool Write(double _value, double &_data[], long _magic_no) {
+    string _params[];
+    if (handle == INVALID_HANDLE) {
+      return false;
+    }
+    EATesterMetrics::FrameToJson(writer, 0, _value, _data, _params, _magic_no);
+    return true;
+  }
+
+  /**
+   * Flushes the written passes and closes the file.
+   */
+  void Close() {
+    if (handle != INVALID_HANDLE) {
+      writer.Flush();
+      FileClose(handle);
+      handle = INVALID_HANDLE;
+      writer.SetFile(INVALID_HANDLE);
+    }
+  }
+};
+
+#endif  // EA_TESTER_H
@@ -0,0 +1,172 @@
+//+------------------------------------------------------------------+
+//|                  EA31337 - multi-strategy advanced trading robot |
+//|                                 Copyright 2016-2024, EA31337 Ltd |
+//|                                       https://github.com/EA31337 |
+//+------------------------------------------------------------------+
+
+/*
+ *  This file is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Benchmark of the call overhead of EA's tick handler.
+ */
+
+// Prevents processing this includes file multiple times.
+#ifndef EA_TICK_BENCH_H
+#define EA_TICK_BENCH_H
+
+/**
+ * Calls EA's tick handler with ticks from a file as fast as possible.
+ *
+ * Ticks are read from a CSV file with the following columns:
+ *   time_msc,bid,ask,last,volume
+ * where time_msc is a time in milliseconds since 1970.01.01.
+ *
+ * Files with the .tkb extension are read in the columnar binary format (see: EATicksFile),
+ * optionally limited to the given range of days.
+ *
+ * The whole file is loaded into memory before the benchmark starts,
+ * so the measured time covers only the calls of the tick handler.
+ *
+ * Note: Ticks are not replayed into the market. Only the tick's time is taken by the handler,
+ * while prices, bars and indicators are read from the terminal's current market state.
+ * So every call processes the same snapshot and the result is the per-call overhead of OnTick().
+ * It is not a replay of the recorded ticks, so it cannot measure the throughput of a backtest.
+ */
+template <typename E>
+class EATickBench {
+ protected:
+  MqlTick ticks[];
+  string file_name;
+  int file_flags;
+  long count;
+  long processed;
+  ulong time_load;   // Time spent on loading ticks (in microseconds).
+  ulong time_calls;  // Time spent on calls of the tick handler (in microseconds).
+
+ public:
+  /**
+   * Class constructor.
+   *
+   * @param
+   *   _file_name - name of the file to load ticks from
+   *   _flags - extra file flags (FILE_COMMON to use the common data folder)
+   */
+  EATickBench(string _file_name, int _flags = FILE_COMMON)
+      : file_name(_file_name), file_flags(_flags), count(0), processed(0), time_load(0), time_calls(0) {}
+
+  /**
+   * Loads ticks from the file.
+   *
+   * @param
+   *   _from - start time of ticks to load (binary files only, 0 for all)
+   *   _to - end time of ticks to load (binary files only, 0 for all)
+   *
+   * @return
+   *   Returns number of loaded ticks, or -1 on error.
+   */
+  long Load(datetime _from = 0, datetime _to = 0) {
+    ulong _time_start = GetMicrosecondCount();
+    if (StringLen(file_name) > 4 && StringFind(file_name, ".tkb", StringLen(file_name) - 4) >= 0) {
+      EATicksFile _file(file_name, file_flags);
+      count = _file.Read(ticks, _from, _to);
+      time_load = GetMicrosecondCount() - _time_start;
+      return count;
+    }
+    int _handle = FileOpen(file_name, FILE_READ | FILE_CSV | FILE_ANSI | file_flags, ',');
+    if (_handle == INVALID_HANDLE) {
+      return -1;
+    }
+    count = 0;
+    ArrayResize(ticks, 0, 1 << 16);
+    while (!FileIsEnding(_handle)) {
+      MqlTick _tick;
+      long _time_msc = StringToInteger(FileReadString(_handle));
+      _tick.time = (datetime)(_time_msc / 1000);
+#ifdef __MQL5__
+      _tick.time_msc = _time_msc;
+#endif
+      _tick.bid = StringToDouble(FileReadString(_handle));
+      _tick.ask = StringToDouble(FileReadString(_handle));
+      _tick.last = StringToDouble(FileReadString(_handle));
+      _tick.volume = (ulong)StringToInteger(FileReadString(_handle));
+      if (_tick.time <= 0) {
+        // Skips header and empty lines.
+        continue;
+      }
+      ArrayResize(ticks, (int)count + 1, 1 << 16);
+      ticks[(int)count++] = _tick;
+    }
+    FileClose(_handle);
+    time_load = GetMicrosecondCount() - _time_start;
+    return count;
+  }
+
+  /**
+   * Saves loaded ticks into the file in the columnar binary format.
+   */
+  bool Save(string _file_name, int _digits) {
+    EATicksFile _file(_file_name, file_flags);
+    return _file.Write(ticks, (int)count, _digits);
+  }
+
+  /**
+   * Calls the EA's tick handler with each loaded tick.
+   *
+   * @param
+   *   _ea - EA instance to process the ticks
+   *   _limit - maximum number of ticks to process (0 for all)
+   *
+   * @return
+   *   Returns number of calls.
+   */
+  long Run(E *_ea, long _limit = 0) {
+    processed = _limit > 0 ? (long)fmin(_limit, count) : count;
+    ulong _time_start = GetMicrosecondCount();
+    for (int _i = 0; _i < processed; _i++) {
+      _ea.OnTick(ticks[_i]);
+    }
+    time_calls = GetMicrosecondCount() - _time_start;
+    return processed;
+  }
+
+  /* Getters */
+
+  /**
+   * Gets number of loaded ticks.
+   */
+  long GetCount() { return count; }
+
+  /**
+   * Gets number of processed ticks.
+   */
+  long GetProcessed() { return processed; }
+
+  /**
+   * Gets average time of the tick handler's call (in microseconds).
+   */
+  double GetTimePerCall() { return processed > 0 ? (double)time_calls / processed : 0; }
+
+  /**
+   * Returns textual representation of the benchmark's stats.
+   */
+  string ToString() {
+    return StringFormat("Called OnTick() with %d ticks from %s in %.3fs (%.2fus per call), loaded in %.3fs.",
+                        processed, file_name, time_calls / 1000000.0, GetTimePerCall(), time_load / 1000000.0);
+  }
+};
+
+#endif  // EA_TICK_BENCH_H
@@ -0,0 +1,166 @@
+//+------------------------------------------------------------------+
+//|                  EA31337 - multi-strategy advanced trading robot |
+//|                                 Copyright 2016-2024, EA31337 Ltd |
+//|                                       https://github.com/EA31337 |
+//+------------------------------------------------------------------+
+
+/*
+ *  This file is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Tick filter evaluated once per tick for all strategies' timeframes.
+ */
+
+// Prevents processing this includes file multiple times.
+#ifndef EA_TICK_FILTER_H
+#define EA_TICK_FILTER_H
+
+// Tick filter methods (as used by STRAT_PARAM_TFM).
+enum ENUM_EA_TICK_FILTER {
+  EA_TICK_FILTER_PER_MIN = 1 << 0,     // Process on every minute.
+  EA_TICK_FILTER_PEAKS = 1 << 1,       // Process low and high ticks of a bar.
+  EA_TICK_FILTER_PEAKS_MINS = 1 << 2,  // Process only peak prices of each minute.
+  EA_TICK_FILTER_UNIQUE = 1 << 3,      // Process only unique ticks.
+  EA_TICK_FILTER_MID_BAR = 1 << 4,     // Process ticks in the middle of the bar.
+  EA_TICK_FILTER_OPEN = 1 << 5,        // Process bar open price ticks.
+  EA_TICK_FILTER_10TH_BAR = 1 << 6,    // Process every 10th of the bar.
+};
+
+/**
+ * Decides which timeframes should process the tick.
+ *
+ * The filter method is decoded once, and bar times are derived arithmetically from the tick time,
+ * so the common case of discarding the tick does not touch any strategy nor chart.
+ * Filters depending on chart's prices (peaks) cannot be decided here, so they always pass.
+ */
+class EATickFilter {
+ protected:
+  bool enabled;          // Whether filter can reject ticks.
+  bool is_and;           // Whether all methods should pass (otherwise any).
+  int methods;           // Decoded methods (absolute value).
+  unsigned int tfs;      // Bitmask of strategies' timeframes (by timeframe index).
+  int tfs_secs[];        // Timeframes' periods in seconds (by timeframe index).
+  bool tfs_unsupported;  // Whether there is a timeframe with bars not aligned to a day.
+  MqlTick last_tick;     // Previous tick.
+
+  /**
+   * Gets index of the timeframe.
+   */
+  int GetTfIndex(ENUM_TIMEFRAMES _tf) {
+    return (int)ChartTf::TfToIndex(_tf == PERIOD_CURRENT ? (ENUM_TIMEFRAMES)Period() : _tf);
+  }
+
+  /**
+   * Checks the tick for the timeframe.
+   */
+  bool Check(const MqlTick &_tick, int _secs) {
+    bool _res = is_and;
+    bool _val;
+    if ((methods & EA_TICK_FILTER_PER_MIN) != 0) {
+      _val = _tick.time % 60 < last_tick.time % 60;
+      _res = is_and ? _res && _val : _res || _val;
+    }
+    if ((methods & (EA_TICK_FILTER_PEAKS | EA_TICK_FILTER_PEAKS_MINS)) != 0) {
+      // Depends on chart's prices, so it is left for strategies to decide.
+      _res = is_and ? _res : true;
+    }
+    if ((methods & EA_TICK_FILTER_UNIQUE) != 0) {
+      _val = _tick.bid != last_tick.bid && _tick.ask != last_tick.ask;
+      _res = is_and ? _res && _val : _res || _val;
+    }
+    if ((methods & EA_TICK_FILTER_MID_BAR) != 0) {
+      _val = _tick.time % _secs == _secs / 2;
+      _res = is_and ? _res && _val : _res || _val;
+    }
+    if ((methods & EA_TICK_FILTER_OPEN) != 0) {
+      _val = last_tick.time < _tick.time - _tick.time % _secs;
+      _res = is_and ? _res && _val : _res || _val;
+    }
+    if ((methods & EA_TICK_FILTER_10TH_BAR) != 0) {
+      _val = _tick.time % (_secs / 10) == 0;
+      _res = is_and ? _res && _val : _res || _val;
+    }
+    return _res;
+  }
+
+ public:
+  /**
+   * Class constructor.
+   */
+  EATickFilter() : enabled(false), is_and(true), methods(0), tfs(0), tfs_unsupported(false) {
+    ArrayResize(tfs_secs, FINAL_ENUM_TIMEFRAMES_INDEX);
+    ArrayInitialize(tfs_secs, 0);
+    last_tick.time = 0;
+    last_tick.bid = 0;
+    last_tick.ask = 0;
+  }
+
+  /**
+   * Adds timeframe of the strategy.
+   */
+  void AddTf(ENUM_TIMEFRAMES _tf) {
+    int _tfi = GetTfIndex(_tf);
+    int _secs = PeriodSeconds(_tf);
+    tfs |= 1 << _tfi;
+    tfs_secs[_tfi] = _secs;
+    // Only bars of M1..H12 start at multiples of their periods since the day start.
+    tfs_unsupported |= _secs < 60 || 86400 % _secs != 0 || _secs == 86400;
+    SetMethod(is_and ? methods : -methods);
+  }
+
+  /**
+   * Sets tick filter method, the same as the one passed to strategies via STRAT_PARAM_TFM.
+   *
+   * Peak methods always pass, so combined with other methods by AND they are decided by the others,
+   * and combined by OR the filter cannot reject any tick, so it is disabled.
+   */
+  void SetMethod(int _method) {
+    is_and = _method >= 0;
+    methods = (int)fabs(_method);
+    // When any method is enough, peaks can always pass, so no tick can be rejected.
+    enabled = methods != 0 && !tfs_unsupported &&
+              !(!is_and && (methods & (EA_TICK_FILTER_PEAKS | EA_TICK_FILTER_PEAKS_MINS)) != 0);
+  }
+
+  /**
+   * Evaluates the tick.
+   *
+   * @return
+   *   Returns bitmask of timeframes (by timeframe index) which should process the tick.
+   */
+  unsigned int Filter(const MqlTick &_tick) {
+    unsigned int _result = tfs;
+    if (enabled) {
+      _result = 0;
+      for (int _tfi = 0; _tfi < FINAL_ENUM_TIMEFRAMES_INDEX; _tfi++) {
+        if ((tfs & (1 << _tfi)) != 0 && Check(_tick, tfs_secs[_tfi])) {
+          _result |= 1 << _tfi;
+        }
+      }
+    }
+    last_tick = _tick;
+    return _result;
+  }
+
+  /* Getters */
+
+  /**
+   * Checks whether filter can reject ticks.
+   */
+  bool IsEnabled() { return enabled; }
+};
+
+#endif  // EA_TICK_FILTER_H
@@ -0,0 +1,302 @@
+//+------------------------------------------------------------------+
+//|                  EA31337 - multi-strategy advanced trading robot |
+//|                                 Copyright 2016-2024, EA31337 Ltd |
+//|                                       https://github.com/EA31337 |
+//+------------------------------------------------------------------+
+
+/*
+ *  This file is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Columnar binary format of tick history.
+ *
+ * File layout (little-endian):
+ *   header: int magic, int version, int digits, int chunks, long index_offset
+ *   chunks: one per day (or more when differences do not fit into int), each with columns one after another:
+ *     int dtime[count]  - time difference from the previous tick (in ms)
+ *     int dbid[count]   - bid difference from the previous tick (in points)
+ *     int dask[count]   - ask difference from the previous tick (in points)
+ *     int dlast[count]  - last difference from the previous tick (in points)
+ *     uint volume[count]
+ *   index: per chunk: long time_msc, long bid, long ask, long last, long offset, int count
+ *     where time and prices are the base values of the first tick of the chunk (so its differences are 0).
+ */
+
+// Prevents processing this includes file multiple times.
+#ifndef EA_TICKS_FILE_H
+#define EA_TICKS_FILE_H
+
+// Defines.
+#define EA_TICKS_FILE_MAGIC 0x4B544145  // "EATK".
+#define EA_TICKS_FILE_VERSION 1
+#define EA_TICKS_FILE_HEADER_SIZE 24  // Size of the header (in bytes).
+
+/**
+ * Index entry of a chunk (one day of ticks).
+ */
+struct EATicksFileChunk {
+  long time_msc;  // Base time (in ms).
+  long bid;       // Base bid (in points).
+  long ask;       // Base ask (in points).
+  long last;      // Base last (in points).
+  long offset;    // Offset of the chunk in the file.
+  int count;      // Number of ticks.
+};
+
+/**
+ * Reads and writes ticks in the columnar binary format.
+ *
+ * Ticks are read in whole days found via the index, so a date range can be read without parsing other days.
+ */
+class EATicksFile {
+ protected:
+  string file_name;
+  int file_flags;
+  int digits;
+  double point;
+  EATicksFileChunk chunks[];
+
+  /**
+   * Scales price into integer points.
+   */
+  long ToPoints(double _price) { return (long)MathRound(_price / point); }
+
+  /**
+   * Gets time of the tick (in ms).
+   */
+  long ToTimeMsc(MqlTick &_tick) {
+#ifdef __MQL5__
+    return _tick.time_msc;
+#else
+    return (long)_tick.time * 1000;
+#endif
+  }
+
+  /**
+   * Checks whether the difference fits into the int column.
+   */
+  bool IsInt(long _value) { return _value >= INT_MIN && _value <= INT_MAX; }
+
+  /**
+   * Reads the chunk and decodes its ticks.
+   */
+  bool ReadChunk(int _handle, EATicksFileChunk &_chunk, MqlTick &_ticks[], int _offset) {
+    int _dtime[], _dbid[], _dask[], _dlast[];
+    uint _volume[];
+    FileSeek(_handle, _chunk.offset, SEEK_SET);
+    if (FileReadArray(_handle, _dtime, 0, _chunk.count) != _chunk.count ||
+        FileReadArray(_handle, _dbid, 0, _chunk.count) != _chunk.count ||
+        FileReadArray(_handle, _dask, 0, _chunk.count) != _chunk.count ||
+        FileReadArray(_handle, _dlast, 0, _chunk.count) != _chunk.count ||
+        FileReadArray(_handle, _volume, 0, _chunk.count) != _chunk.count) {
+      return false;
+    }
+    long _time_msc = _chunk.time_msc, _bid = _chunk.bid, _ask = _chunk.ask, _last = _chunk.last;
+    for (int _i = 0; _i < _chunk.count; _i++) {
+      _time_msc += _dtime[_i];
+      _bid += _dbid[_i];
+      _ask += _dask[_i];
+      _last += _dlast[_i];
+      ZeroMemory(_ticks[_offset + _i]);
+      _ticks[_offset + _i].time = (datetime)(_time_msc / 1000);
+      _ticks[_offset + _i].bid = _bid * point;
+      _ticks[_offset + _i].ask = _ask * point;
+      _ticks[_offset + _i].last = _last * point;
+      _ticks[_offset + _i].volume = _volume[_i];
+#ifdef __MQL5__
+      _ticks[_offset + _i].time_msc = _time_msc;
+      _ticks[_offset + _i].volume_real = _volume[_i];
+      // Flags are not stored, so they are restored from fields which have changed.
+      _ticks[_offset + _i].flags = (_dbid[_i] != 0 ? TICK_FLAG_BID : 0) | (_dask[_i] != 0 ? TICK_FLAG_ASK : 0) |
+                                   (_dlast[_i] != 0 ? TICK_FLAG_LAST : 0) | (_volume[_i] > 0 ? TICK_FLAG_VOLUME : 0);
+#endif
+    }
+    return true;
+  }
+
+ public:
+  /**
+   * Class constructor.
+   *
+   * @param
+   *   _file_name - name of the file
+   *   _flags - extra file flags (FILE_COMMON to use the common data folder)
+   */
+  EATicksFile(string _file_name, int _flags = FILE_COMMON) : file_name(_file_name), file_flags(_flags), digits(0) {
+    point = 1;
+  }
+
+  /**
+   * Writes ticks into the file.
+   *
+   * @param
+   *   _ticks - ticks in chronological order
+   *   _count - number of ticks to write
+   *   _digits - price precision used for integer scaling
+   */
+  bool Write(MqlTick &_ticks[], int _count, int _digits) {
+    int _handle = FileOpen(file_name, FILE_WRITE | FILE_BIN | file_flags);
+    if (_handle == INVALID_HANDLE) {
+      return false;
+    }
+    digits = _digits;
+    point = 1.0 / MathPow(10, digits);
+    ArrayResize(chunks, 0, 256);
+    // Header is written again on close, when the index offset is known.
+    FileSeek(_handle, EA_TICKS_FILE_HEADER_SIZE, SEEK_SET);
+    int _dtime[], _dbid[], _dask[], _dlast[];
+    uint _volume[];
+    for (int _start = 0; _start < _count;) {
+      long _day = (long)_ticks[_start].time / 86400;
+      int _end = _start;
+      while (_end < _count && (long)_ticks[_end].time / 86400 == _day) {
+        _end++;
+      }
+      // Base values are the ones of the chunk's first tick.
+      long _time_msc = ToTimeMsc(_ticks[_start]);
+      long _bid = ToPoints(_ticks[_start].bid);
+      long _ask = ToPoints(_ticks[_start].ask);
+      long _last = ToPoints(_ticks[_start].last);
+      int _ci = ArraySize(chunks);
+      ArrayResize(chunks, _ci + 1, 256);
+      chunks[_ci].time_msc = _time_msc;
+      chunks[_ci].bid = _bid;
+      chunks[_ci].ask = _ask;
+      chunks[_ci].last = _last;
+      chunks[_ci].offset = (long)FileTell(_handle);
+      ArrayResize(_dtime, _end - _start);
+      ArrayResize(_dbid, _end - _start);
+      ArrayResize(_dask, _end - _start);
+      ArrayResize(_dlast, _end - _start);
+      ArrayResize(_volume, _end - _start);
+      int _size = 0;
+      for (; _start + _size < _end; _size++) {
+        long _tick_msc = ToTimeMsc(_ticks[_start + _size]);
+        long _tick_bid = ToPoints(_ticks[_start + _size].bid);
+        long _tick_ask = ToPoints(_ticks[_start + _size].ask);
+        long _tick_last = ToPoints(_ticks[_start + _size].last);
+        if (!IsInt(_tick_msc - _time_msc) || !IsInt(_tick_bid - _bid) || !IsInt(_tick_ask - _ask) ||
+            !IsInt(_tick_last - _last)) {
+          // Differences do not fit, so the next chunk starts from this tick.
+          break;
+        }
+        _dtime[_size] = (int)(_tick_msc - _time_msc);
+        _dbid[_size] = (int)(_tick_bid - _bid);
+        _dask[_size] = (int)(_tick_ask - _ask);
+        _dlast[_size] = (int)(_tick_last - _last);
+        _volume[_size] = (uint)_ticks[_start + _size].volume;
+        _time_msc = _tick_msc;
+        _bid = _tick_bid;
+        _ask = _tick_ask;
+        _last = _tick_last;
+      }
+      chunks[_ci].count = _size;
+      FileWriteArray(_handle, _dtime, 0, _size);
+      FileWriteArray(_handle, _dbid, 0, _size);
+      FileWriteArray(_handle, _dask, 0, _size);
+      FileWriteArray(_handle, _dlast, 0, _size);
+      FileWriteArray(_handle, _volume, 0, _size);
+      _start += _size;
+    }
+    long _index_offset = (long)FileTell(_handle);
+    for (int _ci = 0; _ci < ArraySize(chunks); _ci++) {
+      FileWriteLong(_handle, chunks[_ci].time_msc);
+      FileWriteLong(_handle, chunks[_ci].bid);
+      FileWriteLong(_handle, chunks[_ci].ask);
+      FileWriteLong(_handle, chunks[_ci].last);
+      FileWriteLong(_handle, chunks[_ci].offset);
+      FileWriteInteger(_handle, chunks[_ci].count);
+    }
+    FileSeek(_handle, 0, SEEK_SET);
+    FileWriteInteger(_handle, EA_TICKS_FILE_MAGIC);
+    FileWriteInteger(_handle, EA_TICKS_FILE_VERSION);
+    FileWriteInteger(_handle, digits);
+    FileWriteInteger(_handle, ArraySize(chunks));
+    FileWriteLong(_handle, _index_offset);
+    FileClose(_handle);
+    return true;
+  }
+
+  /**
+   * Reads ticks of the given time range (in whole days).
+   *
+   * @param
+   *   _ticks - array to read ticks into
+   *   _from - start time (0 to read from the beginning)
+   *   _to - end time (0 to read until the end)
+   *
+   * @return
+   *   Returns number of read ticks, or -1 on error.
+   */
+  int Read(MqlTick &_ticks[], datetime _from = 0, datetime _to = 0) {
+    int _handle = FileOpen(file_name, FILE_READ | FILE_BIN | FILE_SHARE_READ | file_flags);
+    if (_handle == INVALID_HANDLE) {
+      return -1;
+    }
+    if (FileReadInteger(_handle) != EA_TICKS_FILE_MAGIC || FileReadInteger(_handle) != EA_TICKS_FILE_VERSION) {
+      FileClose(_handle);
+      return -1;
+    }
+    digits = FileReadInteger(_handle);
+    point = 1.0 / MathPow(10, digits);
+    int _chunks = FileReadInteger(_handle);
+    FileSeek(_handle, FileReadLong(_handle), SEEK_SET);
+    ArrayResize(chunks, _chunks);
+    for (int _ci = 0; _ci < _chunks; _ci++) {
+      chunks[_ci].time_msc = FileReadLong(_handle);
+      chunks[_ci].bid = FileReadLong(_handle);
+      chunks[_ci].ask = FileReadLong(_handle);
+      chunks[_ci].last = FileReadLong(_handle);
+      chunks[_ci].offset = FileReadLong(_handle);
+      chunks[_ci].count = FileReadInteger(_handle);
+    }
+    // Finds the first chunk of the range (chunks do not span over days, base time is of its first tick).
+    int _lo = 0, _hi = _chunks;
+    while (_lo < _hi) {
+      int _mid = (_lo + _hi) / 2;
+      long _end_msc = (chunks[_mid].time_msc / 86400000 + 1) * 86400000;
+      if (_end_msc <= (long)_from * 1000) {
+        _lo = _mid + 1;
+      } else {
+        _hi = _mid;
+      }
+    }
+    int _count = 0;
+    ArrayResize(_ticks, 0, 1 << 16);
+    for (int _ci = _lo; _ci < _chunks; _ci++) {
+      if (_to > 0 && chunks[_ci].time_msc > (long)_to * 1000) {
+        break;
+      }
+      ArrayResize(_ticks, _count + chunks[_ci].count, 1 << 16);
+      if (!ReadChunk(_handle, chunks[_ci], _ticks, _count)) {
+        FileClose(_handle);
+        return -1;
+      }
+      _count += chunks[_ci].count;
+    }
+    FileClose(_handle);
+    return _count;
+  }
+
+  /* Getters */
+
+  /**
+   * Gets number of chunks (days) of the last read or written file.
+   */
+  int GetChunks() { return ArraySize(chunks); }
+};
+
+#endif  // EA_TICKS_FILE_H
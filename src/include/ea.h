@@ -29,6 +29,32 @@
 
 class EA31337 : public EA {
  protected:
+  EADashboard dashboard;
+  EALogBuffer log_buffer;
+  EATasksCompiled tasks_compiled;
+  EATickFilter tick_filter;
+#ifdef __indi_shared__
+  EAIndicatorsCache indis_shared;
+#endif
+  int tasks_generic;  // Number of tasks added as generic ones.
+  int tick_minute;    // Minute of the last processed tick.
+  string symbol;      // Symbol traded by the instance.
+#ifdef __MQL5__
+  EAOrdersCache orders_cache;
+#endif
+  Dict<long, long> strats_by_type_tf;              // Maps strategy type and timeframe into magic number.
+  long strats_by_tf[FINAL_ENUM_TIMEFRAMES_INDEX];  // Magic number of the first strategy per timeframe.
+#ifdef __lazy__
+  EAStrategyPending strats_pending[];  // Strategies waiting for initialization.
+  datetime strats_pending_time;        // Time of the last check for new bars (in minutes).
+#endif
+#ifdef __ea_profiler__
+  EAProfiler profiler;
+#endif
+#ifdef __signals_net__
+  EASignalsNet signals_net;  // Strategies' signals collected during the tick.
+#endif
+
   /**
    * Initialize EA.
    */
@@ -37,7 +63,17 @@ class EA31337 : public EA {
     PrintFormat("%s v%s by %s initializing...", Get<string>(STRUCT_ENUM(EAParams, EA_PARAM_PROP_NAME)),
                 Get<string>(STRUCT_ENUM(EAParams, EA_PARAM_PROP_VER)),
                 Get<string>(STRUCT_ENUM(EAParams, EA_PARAM_PROP_AUTHOR)));
-    long _magic_no = EA_MagicNumber;
+#ifdef __MQL5__
+    orders_cache.SetSymbol(symbol);
+    orders_cache.SetTrade(GetTrade(symbol));
+    orders_cache.SetLogBuffer(GetPointer(log_buffer));
+    orders_cache.Refresh();
+    tasks_compiled.SetOrdersCache(GetPointer(orders_cache));
+#endif
+    tasks_compiled.SetSymbol(symbol);
+    dashboard.SetHeader(StringFormat("%s v%s by %s\n", Get<string>(STRUCT_ENUM(EAParams, EA_PARAM_PROP_NAME)),
+                                     Get<string>(STRUCT_ENUM(EAParams, EA_PARAM_PROP_VER)),
+                                     Get<string>(STRUCT_ENUM(EAParams, EA_PARAM_PROP_AUTHOR))));
     ResetLastError();
     return _initiated;
   }
@@ -45,8 +81,89 @@ class EA31337 : public EA {
  public:
   /**
    * Class constructor.
+   *
+   * @param
+   *   _params - EA params (symbol is taken from EA_PARAM_PROP_SYMBOL, chart's symbol when empty)
    */
-  EA31337(EAParams &_params) : EA(_params) { Init(); }
+  EA31337(EAParams &_params) : EA(_params), dashboard(ea_dashboard_refresh) {
+    ArrayInitialize(strats_by_tf, 0);
+    tasks_generic = 0;
+    tick_minute = 0;
+    symbol = Get<string>(STRUCT_ENUM(EAParams, EA_PARAM_PROP_SYMBOL));
+    if (symbol == NULL || symbol == "") {
+      symbol = _Symbol;
+    }
+    log_buffer.SetLevel(Get<ENUM_LOG_LEVEL>(STRUCT_ENUM(EAParams, EA_PARAM_PROP_LOG_LEVEL)));
+#ifdef __lazy__
+    strats_pending_time = 0;
+#endif
+    Init();
+  }
+
+  /**
+   * Class destructor.
+   */
+  ~EA31337() { FlushLogs(); }
+
+  /* Getters */
+
+  /**
+   * Gets symbol traded by the instance.
+   */
+  string GetSymbol() { return symbol; }
+
+  /**
+   * Gets pointer to the buffered log (printed on timer or on a new minute).
+   */
+  EALogBuffer *GetLogBuffer() { return GetPointer(log_buffer); }
+
+  /**
+   * Prints the buffered log along with the EA's logger.
+   */
+  void FlushLogs() {
+    log_buffer.Flush();
+    logger.Flush();
+  }
+
+#ifdef __MQL5__
+  /**
+   * Gets pointer to the cache of open positions.
+   */
+  EAOrdersCache *GetOrdersCache() { return GetPointer(orders_cache); }
+#endif
+
+#ifdef __ea_profiler__
+  /**
+   * Gets pointer to the profiler.
+   */
+  EAProfiler *GetProfiler() { return GetPointer(profiler); }
+#endif
+
+  /**
+   * Returns signal entry for the given strategy.
+   *
+   * With __signals_net__, the entry is collected for netting at the end of the tick
+   * and an empty entry is returned instead, so it is not traded on its own.
+   *
+   * <inheritdoc/>
+   *
+   */
+  TradeSignalEntry GetStrategySignalEntry(Strategy *_strat, bool _trade_allowed = true, int _shift = -1) {
+#ifdef __ea_profiler__
+    ulong _time_start = GetMicrosecondCount();
+#endif
+    TradeSignalEntry _entry = EA::GetStrategySignalEntry(_strat, _trade_allowed, _shift);
+#ifdef __ea_profiler__
+    profiler.AddStrategy(_strat, (long)(GetMicrosecondCount() - _time_start));
+#endif
+#ifdef __signals_net__
+    signals_net.Add(_entry, _trade_allowed);
+    TradeSignalEntry _none;
+    return _none;
+#else
+    return _entry;
+#endif
+  }
 
   /**
    * Adds EA's task.
@@ -149,6 +266,40 @@ class EA31337 : public EA {
     return TaskEntry(_action_entry, _cond_entry);
   }
 
+  /**
+   * Sets tick filter method applied by all strategies (see: STRAT_PARAM_TFM).
+   */
+  void SetTickFilterMethod(int _method) { tick_filter.SetMethod(_method); }
+
+  /**
+   * Adds EA's task.
+   *
+   * Tasks with supported condition and action pairs are compiled into typed evaluators,
+   * others are added as generic tasks (except of actions supported only by compiled tasks).
+   */
+  bool TaskAddCompiled(ENUM_EA_ADV_COND _cond, ENUM_EA_ADV_ACTION _action) {
+    if (_cond == EA_ADV_COND_NONE && _action == EA_ADV_ACTION_NONE) {
+      // Empty task.
+      return true;
+    }
+    if (tasks_compiled.Add(_cond, _action)) {
+      return true;
+    }
+    if (_action == EA_ADV_ACTION_CLOSE_LEAST_LOSS || _action == EA_ADV_ACTION_CLOSE_LEAST_PROFIT) {
+      // Closing by the least loss or profit relies on the cache of open positions (MQL5 only),
+      // so it is supported only with compiled conditions.
+      if (log_buffer.IsEnabled(V_ERROR)) {
+        log_buffer.Error(StringFormat("Task action %s is not supported with condition %s!", EnumToString(_action),
+                                      EnumToString(_cond)),
+                         __FUNCTION_LINE__);
+      }
+      SetUserError(ERR_INVALID_PARAMETER);
+      return false;
+    }
+    tasks_generic++;
+    return TaskAdd(GetTaskEntry(_cond, _action));
+  }
+
   /**
    * Executed on strategy being added.
    *
@@ -156,7 +307,22 @@ class EA31337 : public EA {
    *
    */
   void OnStrategyAdd(Strategy *_strat) {
+#ifdef __indi_shared__
+    indis_shared.Share(_strat);
+#endif
     EA::OnStrategyAdd(_strat);
+    // Updates lookup indexes.
+    long _magic_no = _strat.Get<long>(STRAT_PARAM_ID);
+    ENUM_TIMEFRAMES _tf = _strat.Get<ENUM_TIMEFRAMES>(STRAT_PARAM_TF);
+    strats_by_type_tf.Set(GetStrategyIndexKey(_strat.Get<int>(STRAT_PARAM_TYPE), _tf), _magic_no);
+    int _tfi = GetStrategyIndexTf(_tf);
+    if (strats_by_tf[_tfi] == 0) {
+      strats_by_tf[_tfi] = _magic_no;
+    }
+#ifdef __MQL5__
+    orders_cache.AddMagicNo(_magic_no);
+#endif
+    tick_filter.AddTf(_tf);
     switch (_strat.Get<ENUM_STRATEGY>(STRAT_PARAM_TYPE)) {
       case STRAT_META_MIRROR:
         // @todo: Move this logic to strategy.
@@ -175,42 +341,175 @@ class EA31337 : public EA {
    * Invoked when a new tick for a symbol is received, to the chart of which the Expert Advisor is attached.
    */
   void OnTick(MqlTick &_tick) {
+#ifdef __ea_profiler__
+    ulong _time_start = GetMicrosecondCount();
+#endif
+    int _tick_minute = (int)(_tick.time / 60);
+    bool _new_minute = tick_minute != _tick_minute;
+    if (_new_minute) {
+      // Prints the buffered log in case the timer is not running (e.g. in the tester).
+      FlushLogs();
+      tick_minute = _tick_minute;
+    }
+    if (tick_filter.IsEnabled() && tick_filter.Filter(_tick) == 0 && !_new_minute && tasks_generic == 0 &&
+        GetTrade(symbol).GetOrdersActive().Size() == 0) {
+      // No strategy would process the tick, there is no new bar, no task to check nor order to manage.
+#ifdef __ea_profiler__
+      profiler.AddTick((long)(GetMicrosecondCount() - _time_start));
+#endif
+      return;
+    }
+#ifdef __signals_net__
+    signals_net.Reset();
+#endif
     EAProcessResult _result = ProcessTick();
-    if (_result.stg_processed_periods > 0) {
-      if (EA_DisplayDetailsOnChart && (Terminal::IsVisualMode() || Terminal::IsRealtime())) {
-        string _text = StringFormat("%s v%s by %s\n", Get<string>(STRUCT_ENUM(EAParams, EA_PARAM_PROP_NAME)),
-                                    Get<string>(STRUCT_ENUM(EAParams, EA_PARAM_PROP_VER)),
-                                    Get<string>(STRUCT_ENUM(EAParams, EA_PARAM_PROP_AUTHOR)));
-
-        _text += SerializerConverter::FromObject(THIS_PTR, SERIALIZER_FLAG_INCLUDE_DYNAMIC)
-                     .Precision(0)
-                     .ToString<SerializerJson>(SERIALIZER_JSON_NO_WHITESPACES) +
-                 "\n";
-        /* @todo
-        _text +=
-            SerializerConverter::FromObject(_result).Precision(0).ToString<SerializerJson>(SERIALIZER_JSON_NO_WHITESPACES)
-        +
-            "\n";
-        */
-        if (Get<ENUM_LOG_LEVEL>(STRUCT_ENUM(EAParams, EA_PARAM_PROP_LOG_LEVEL)) >= V_DEBUG) {
-          // Print enabled strategies info.
-          for (DictStructIterator<long, Ref<Strategy>> _siter = ea.GetStrategies().Begin(); _siter.IsValid();
-               ++_siter) {
-            Strategy *_strat = _siter.Value().Ptr();
-            StgProcessResult _sres = _strat.GetProcessResult();
-            _text += StringFormat("%s@%d: %s\n", _strat.GetName(), _strat.Get<ENUM_TIMEFRAMES>(STRAT_PARAM_TF),
-                                  SerializerConverter::FromObject(_sres, SERIALIZER_FLAG_INCLUDE_DYNAMIC)
-                                      .Precision(2)
-                                      .ToString<SerializerJson>(SERIALIZER_JSON_NO_WHITESPACES));
-          }
+#ifdef __signals_net__
+    ProcessSignalsNet(_tick);
+#endif
+    // Tasks are processed after the strategies have processed the tick.
+    tasks_compiled.Process(GetTrade(symbol));
+    if (_result.stg_processed_periods > 0 && EA_DisplayDetailsOnChart) {
+      // Chart details are rendered on the timer event.
+      dashboard.SetDirty();
+    }
+#ifdef __ea_profiler__
+    profiler.AddTick((long)(GetMicrosecondCount() - _time_start));
+#endif
+  }
+
+  /**
+   * "Timer" event handler function.
+   */
+  void OnTimer() {
+    FlushLogs();
+    if (EA_DisplayDetailsOnChart) {
+      DisplayDetails();
+    }
+  }
+
+  /**
+   * Displays EA details on the chart.
+   *
+   * Rendering is limited to one per refresh interval and only sections
+   * which have changed since the last render are serialized again.
+   */
+  void DisplayDetails() {
+    if (!dashboard.IsDue() || !(Terminal::IsVisualMode() || Terminal::IsRealtime())) {
+      return;
+    }
+    if (dashboard.IsDirty()) {
+      dashboard.SetSection(SerializerConverter::FromObject(THIS_PTR, SERIALIZER_FLAG_INCLUDE_DYNAMIC)
+                               .Precision(0)
+                               .ToString<SerializerJson>(SERIALIZER_JSON_NO_WHITESPACES) +
+                           "\n");
+    }
+    if (Get<ENUM_LOG_LEVEL>(STRUCT_ENUM(EAParams, EA_PARAM_PROP_LOG_LEVEL)) >= V_DEBUG) {
+      // Print enabled strategies info, updated once per strategy's bar.
+      for (DictStructIterator<long, Ref<Strategy>> _siter = GetStrategies().Begin(); _siter.IsValid(); ++_siter) {
+        Strategy *_strat = _siter.Value().Ptr();
+        long _magic_no = _strat.Get<long>(STRAT_PARAM_ID);
+        ENUM_TIMEFRAMES _tf = _strat.Get<ENUM_TIMEFRAMES>(STRAT_PARAM_TF);
+        datetime _bar_time = iTime(symbol, _tf, 0);
+        if (dashboard.IsDirty(_magic_no, _bar_time)) {
+          StgProcessResult _sres = _strat.GetProcessResult();
+          dashboard.SetSection(_magic_no,
+                               StringFormat("%s@%d: %s\n", _strat.GetName(), _tf,
+                                            SerializerConverter::FromObject(_sres, SERIALIZER_FLAG_INCLUDE_DYNAMIC)
+                                                .Precision(2)
+                                                .ToString<SerializerJson>(SERIALIZER_JSON_NO_WHITESPACES)),
+                               _bar_time);
         }
+      }
+    }
+    Comment(dashboard.Render(log_buffer.ToString()));
+  }
 
-        _text += logger.ToString();
-        Comment(_text);
+#ifdef __signals_net__
+  /**
+   * Executes netted signals collected during the tick.
+   *
+   * Issues at most one close operation per side and one order to open.
+   * The order is opened through EA's signal manager by the strategy's entry,
+   * so it is subject to the same lot size, spread and risk checks as without netting.
+   *
+   * @return
+   *   Returns number of executed operations.
+   */
+  int ProcessSignalsNet(const MqlTick &_tick) {
+    int _count = 0;
+    if (signals_net.Net() == 0) {
+      return _count;
+    }
+    Dict<long, int> _magic_nos;
+    for (int _side = 0; _side < 2; _side++) {
+      if (signals_net.IsClose(_side) && signals_net.GetCloseMagicNos(_side, _magic_nos) > 0) {
+#ifdef __MQL5__
+        _count += orders_cache.CloseSide(_side, _magic_nos, ORDER_REASON_CLOSED_BY_SIGNAL) > 0 ? 1 : 0;
+#else
+        _count += OrdersCloseSide(_side, _magic_nos, ORDER_REASON_CLOSED_BY_SIGNAL) > 0 ? 1 : 0;
+#endif
       }
     }
+    TradeSignalEntry _entry;
+    if (signals_net.GetOpenEntry(_entry)) {
+      TradeSignal _signal(_entry);
+      tsm.SignalAdd(_signal);
+      _count += ProcessSignals(_tick) ? 1 : 0;
+    }
+    return _count;
   }
 
+#ifndef __MQL5__
+  /**
+   * Closes active orders of the side opened by the given strategies.
+   *
+   * @param
+   *   _side - 0 for buy, 1 for sell
+   *   _magic_nos - magic numbers of strategies to close orders of
+   *   _reason - reason of closing
+   *
+   * @return
+   *   Returns number of closed orders.
+   */
+  int OrdersCloseSide(int _side, Dict<long, int> &_magic_nos, ENUM_ORDER_REASON_CLOSE _reason) {
+    ENUM_ORDER_TYPE _cmd = _side == 0 ? ORDER_TYPE_BUY : ORDER_TYPE_SELL;
+    Ref<Order> _orders[];
+    // Orders are copied, since closed ones are moved out of active orders.
+    for (DictStructIterator<long, Ref<Order>> _oiter = GetTrade(symbol).GetOrdersActive().Begin(); _oiter.IsValid();
+         ++_oiter) {
+      Order *_order = _oiter.Value().Ptr();
+      if (_order.Get<ENUM_ORDER_TYPE>(ORDER_TYPE) == _cmd && _magic_nos.KeyExists(_order.Get<long>(ORDER_MAGIC))) {
+        int _size = ArraySize(_orders);
+        ArrayResize(_orders, _size + 1, 10);
+        _orders[_size] = _oiter.Value();
+      }
+    }
+    int _count = 0;
+    for (int _i = 0; _i < ArraySize(_orders); _i++) {
+      _count += _orders[_i].Ptr().OrderClose(_reason) ? 1 : 0;
+    }
+    return _count;
+  }
+#endif
+#endif
+
+#ifdef __MQL5__
+  /**
+   * "TradeTransaction" event handler function (MQL5 only).
+   *
+   * Invoked when performing some definite actions on a trade account, its state changes.
+   */
+  void OnTradeTransaction(const MqlTradeTransaction &_trans, const MqlTradeRequest &_request,
+                          const MqlTradeResult &_result) {
+    orders_cache.OnTradeTransaction(_trans);
+#ifdef __ea_profiler__
+    if (_trans.type == TRADE_TRANSACTION_REQUEST) {
+      profiler.AddOrderOp((long)_request.magic);
+    }
+#endif
+  }
+#endif
+
   /**
    * Print startup info.
    */
@@ -258,6 +557,46 @@ class EA31337 : public EA {
     return !Terminal::HasError();
   }
 
+  /**
+   * Gets timeframe index used by strategy lookup indexes.
+   */
+  int GetStrategyIndexTf(ENUM_TIMEFRAMES _tf) {
+    return (int)ChartTf::TfToIndex(_tf == PERIOD_CURRENT ? (ENUM_TIMEFRAMES)Period() : _tf);
+  }
+
+  /**
+   * Gets key used by strategy lookup index by type and timeframe.
+   */
+  long GetStrategyIndexKey(int _type, ENUM_TIMEFRAMES _tf) {
+    return (long)_type * FINAL_ENUM_TIMEFRAMES_INDEX + GetStrategyIndexTf(_tf);
+  }
+
+  /**
+   * Gets strategy by its type and timeframe.
+   *
+   * @return
+   *   Returns strategy pointer, otherwise NULL when not found.
+   */
+  Strategy *GetStrategyByTypeTf(int _type, ENUM_TIMEFRAMES _tf) {
+    long _key = GetStrategyIndexKey(_type, _tf);
+    return strats_by_type_tf.KeyExists(_key) ? GetStrategyByMagic(strats_by_type_tf.GetByKey(_key)) : NULL;
+  }
+
+  /**
+   * Gets the first added strategy for the given timeframe.
+   *
+   * @return
+   *   Returns strategy pointer, otherwise NULL when not found.
+   */
+  Strategy *GetStrategyByTf(ENUM_TIMEFRAMES _tf) { return GetStrategyByMagic(strats_by_tf[GetStrategyIndexTf(_tf)]); }
+
+  /**
+   * Gets strategy by its magic number.
+   */
+  Strategy *GetStrategyByMagic(long _magic_no) {
+    return _magic_no != 0 && strats.KeyExists(_magic_no) ? strats.GetByKey(_magic_no).Ptr() : NULL;
+  }
+
   /**
    * Adds strategy to the given timeframe.
    */
@@ -278,7 +617,7 @@ class EA31337 : public EA {
       if (!strats.KeyExists(_magic_no)) {
         _result &= strats.Set(_magic_no, _strat);
       } else {
-        logger.Error("Strategy adding conflict!", __FUNCTION_LINE__);
+        log_buffer.Fatal("Strategy adding conflict!", __FUNCTION_LINE__);
         DebugBreak();
       }
       OnStrategyAdd(_strat.Ptr());
@@ -308,12 +647,74 @@ class EA31337 : public EA {
     bool _result = true;
     for (int _tfi = 0; _tfi < sizeof(int) * 8; ++_tfi) {
       if ((_tfs & (1 << _tfi)) != 0) {
+#ifdef __lazy__
+        _result &= StrategyAddToTfPending(_sid, ChartTf::IndexToTf((ENUM_TIMEFRAMES_INDEX)_tfi));
+#else
         _result &= StrategyAddToTf(_sid, ChartTf::IndexToTf((ENUM_TIMEFRAMES_INDEX)_tfi));
+#endif
       }
     }
     return _result;
   }
 
+#ifdef __lazy__
+  /**
+   * Adds strategy to the given timeframe to be initialized on the first new bar.
+   *
+   * @see: StrategyInitPending()
+   */
+  bool StrategyAddToTfPending(ENUM_STRATEGY _sid, ENUM_TIMEFRAMES _tf) {
+    if (_sid == STRAT_NONE) {
+      return true;
+    }
+    if (!StrategiesRegistry::IsRegistered(_sid)) {
+      SetUserError(ERR_INVALID_PARAMETER);
+      return false;
+    }
+    int _size = ArraySize(strats_pending);
+    ArrayResize(strats_pending, _size + 1, FINAL_ENUM_TIMEFRAMES_INDEX);
+    strats_pending[_size].sid = _sid;
+    strats_pending[_size].tf = _tf;
+    strats_pending[_size].bar_time = iTime(symbol, _tf, 0);
+    return true;
+  }
+
+  /**
+   * Initializes pending strategies which timeframe has started a new bar.
+   *
+   * @param _strats
+   *   Array to which the newly initialized strategies are appended.
+   *
+   * @return
+   *   Returns number of initialized strategies.
+   */
+  int StrategyInitPending(Strategy *&_strats[]) {
+    int _count = 0;
+    datetime _time = TimeCurrent() / 60;
+    if (ArraySize(strats_pending) == 0 || _time == strats_pending_time) {
+      // New bars can start only on a new minute.
+      return _count;
+    }
+    strats_pending_time = _time;
+    for (int _i = ArraySize(strats_pending) - 1; _i >= 0; _i--) {
+      if (iTime(symbol, strats_pending[_i].tf, 0) != strats_pending[_i].bar_time) {
+        if (StrategyAddToTf(strats_pending[_i].sid, strats_pending[_i].tf)) {
+          Strategy *_strat = GetStrategyByTypeTf(strats_pending[_i].sid, strats_pending[_i].tf);
+          if (_strat != NULL) {
+            int _size = ArraySize(_strats);
+            ArrayResize(_strats, _size + 1);
+            _strats[_size] = _strat;
+          }
+        }
+        strats_pending[_i] = strats_pending[ArraySize(strats_pending) - 1];
+        ArrayResize(strats_pending, ArraySize(strats_pending) - 1);
+        _count++;
+      }
+    }
+    return _count;
+  }
+#endif
+
   /**
    * Adds strategy stops.
    */
@@ -322,10 +723,10 @@ class EA31337 : public EA {
     if (_enum_stg_stops == STRAT_NONE && _strat == NULL) {
       return _result;
     }
-    Strategy *_strat_stops = GetStrategyViaProp2<int, int>(STRAT_PARAM_TYPE, _enum_stg_stops, STRAT_PARAM_TF, _tf);
+    Strategy *_strat_stops = GetStrategyByTypeTf(_enum_stg_stops, _tf);
     if (!_strat_stops) {
       _result &= StrategyAddToTf(_enum_stg_stops, _tf);
-      _strat_stops = GetStrategyViaProp2<int, int>(STRAT_PARAM_TYPE, _enum_stg_stops, STRAT_PARAM_TF, _tf);
+      _strat_stops = GetStrategyByTypeTf(_enum_stg_stops, _tf);
       if (_strat_stops) {
         _strat_stops.Enabled(false);
       }
@@ -28,14 +28,66 @@
 // EA structs.
 #include "common/struct.h"
 
+// EA buffered log.
+#include "common/log-buffer.h"
+
+// EA orders cache.
+#ifdef __MQL5__
+#include "common/orders-cache.h"
+#endif
+
+// EA tick filter.
+#include "common/tick-filter.h"
+
+// EA compiled tasks.
+#include "common/tasks-compiled.h"
+
+// EA chart details.
+#include "common/dashboard.h"
+
+// EA shared indicators.
+#ifdef __indi_shared__
+#include "common/indicators-cache.h"
+#endif
+
+// EA JSON writer.
+#include "common/json-writer.h"
+
+// EA tester's helpers.
+#ifdef __MQL5__
+#include "common/tester.h"
+#endif
+
+// EA parameter sweep.
+#ifdef __sweep__
+#include "common/sweep.h"
+#endif
+
+// EA profiler.
+#ifdef __ea_profiler__
+#include "common/profiler.h"
+#endif
+
 // Strategy enums.
 #include "../strategies-meta/enum.h"
 #include "../strategies/enum.h"
 
 // Strategy managers.
+#include "common/strategies-cache.h"
 #include "common/strategies-manager-meta.h"  // Overrides the default one.
 #include "common/strategies-manager.h" // Overrides the default one.
 
+// Benchmark of OnTick() calls.
+#ifdef __tick_bench__
+#include "common/ticks-file.h"
+#include "common/tick-bench.h"
+#endif
+
+// Netting of strategies' signals.
+#ifdef __signals_net__
+#include "common/signals-net.h"
+#endif
+
 // Main user inputs.
 #include "inputs.h"
 
@@ -44,3 +96,6 @@ INPUT_GROUP("Strategy parameters");  // >>> STRATEGIES <<<
 #include "../strategies/includes.h"
 INPUT_GROUP("Strategy meta parameters");  // >>> STRATEGIES META <<<
 #include "../strategies-meta/includes.h"
+
+// Strategy registry (requires strategy classes).
+#include "common/strategies-registry.h"
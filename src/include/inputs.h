@@ -64,3 +64,36 @@ input group "EA's logging & messaging"
 input ENUM_LOG_LEVEL VerboseLevel = ea_log_level;  // Level of log verbosity
 input bool EA_DisplayDetailsOnChart = true;        // Display EA details on chart
 // input bool WriteSummaryReport = true;                                           // Write summary report on finish
+
+#ifdef __tick_bench__
+#ifdef __MQL4__
+input string __TickBench_Params__ = "-- EA's OnTick() benchmark --";  // >>> EA's ONTICK() BENCHMARK <<<
+#else
+input group "EA's OnTick() benchmark"
+#endif
+input string EA_TickBench_File = "ticks.csv";  // Tick file to call OnTick() with (in common data folder, .csv or .tkb)
+input datetime EA_TickBench_From = 0;          // Ticks from (.tkb only, 0 = all)
+input datetime EA_TickBench_To = 0;            // Ticks to (.tkb only, 0 = all)
+input long EA_TickBench_Limit = 0;             // Max calls (0 = all ticks)
+input string EA_TickBench_Save = "";           // Binary tick file to save loaded ticks into (.tkb)
+#endif
+
+#ifdef __MQL5__
+input group "EA's tester"
+input ENUM_EA_TESTER_CRITERION EA_Tester_Criterion = EA_TESTER_CRITERION_NONE;  // Custom criterion to optimize by
+input int EA_Tester_MinTrades = 0;                                              // Min trades of acceptable pass
+input float EA_Tester_AbortDrawdown = 0;                                        // Abort on drawdown (in %, 0 = off)
+input double EA_Tester_AbortEquity = 0;                                         // Abort on equity below (0 = off)
+input int EA_Tester_AbortLosses = 0;                                            // Abort on consecutive losses (0 = off)
+input string EA_Tester_ResultsFile = "";                                        // Results file to write (.jsonl)
+#endif
+
+#ifdef __sweep__
+#ifdef __MQL4__
+input string __Sweep_Params__ = "-- EA's parameter sweep --";  // >>> EA's PARAMETER SWEEP <<<
+#else
+input group "EA's parameter sweep"
+#endif
+input string EA_Sweep_File = "sweep.csv";  // Sweep file with rows of params (in common data folder)
+input int EA_Sweep_Index = 0;              // Row of params to apply (optimize it to run the sweep)
+#endif